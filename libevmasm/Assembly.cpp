@@ -63,11 +63,12 @@ namespace
 /// instruction locations vector.
 /// If the instruction decomposes into multiple individual evm instructions, `emit` can be
 /// called for all but the last one (which will be emitted by the destructor).
+/// Nothing is recorded if the instruction locations vector is null.
 class InstructionLocationEmitter
 {
 public:
 	InstructionLocationEmitter(
-		std::vector<LinkerObject::InstructionLocation>& _instructionLocations,
+		std::vector<LinkerObject::InstructionLocation>* _instructionLocations,
 		bytes const& _bytecode,
 		size_t const _assemblyItemIndex
 	):
@@ -84,8 +85,10 @@ public:
 
 	void emit()
 	{
+		if (!m_instructionLocations)
+			return;
 		auto const end = m_bytecode.size();
-		m_instructionLocations.push_back(LinkerObject::InstructionLocation{
+		m_instructionLocations->push_back(LinkerObject::InstructionLocation{
 			.start = m_instructionLocationStart,
 			.end = end,
 			.assemblyItemIndex = m_assemblyItemIndex
@@ -94,7 +97,7 @@ public:
 	}
 
 private:
-	std::vector<LinkerObject::InstructionLocation>& m_instructionLocations;
+	std::vector<LinkerObject::InstructionLocation>* m_instructionLocations = nullptr;
 	bytes const& m_bytecode;
 	size_t const m_assemblyItemIndex{};
 	size_t m_instructionLocationStart{};
@@ -994,7 +997,8 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 			isCreation(),
 			isCreation() ? 1 : _settings.expectedExecutionsPerDeployment,
 			m_evmVersion,
-			*this
+			*this,
+			_settings.executionProfile.get()
 		);
 
 	m_tagReplacements = std::move(tagReplacements);
@@ -1120,7 +1124,7 @@ uint16_t calculateMaxStackHeight(Assembly::CodeSection const& _section)
 }
 }
 
-std::tuple<bytes, std::vector<size_t>, size_t> Assembly::createEOFHeader(std::set<ContainerID> const& _referencedSubIds) const
+std::tuple<bytes, std::vector<size_t>, size_t> Assembly::createEOFHeader(std::set<ContainerID> const& _referencedSubIds, bool _debugData) const
 {
 	bytes retBytecode;
 	std::vector<size_t> codeSectionSizePositions;
@@ -1149,7 +1153,7 @@ std::tuple<bytes, std::vector<size_t>, size_t> Assembly::createEOFHeader(std::se
 		appendBigEndianUint16(retBytecode, _referencedSubIds.size());
 
 		for (auto subId: _referencedSubIds)
-			appendBigEndianUint16(retBytecode, m_subs[subId]->assemble().bytecode.size());
+			appendBigEndianUint16(retBytecode, m_subs[subId]->assemble(_debugData).bytecode.size());
 	}
 
 	retBytecode.push_back(0x04);                                        // kind=data
@@ -1169,12 +1173,17 @@ std::tuple<bytes, std::vector<size_t>, size_t> Assembly::createEOFHeader(std::se
 	return {retBytecode, codeSectionSizePositions, dataSectionSizePosition};
 }
 
-LinkerObject const& Assembly::assemble() const
+LinkerObject const& Assembly::assemble(bool _debugData) const
 {
 	solRequire(!m_invalid, AssemblyException, "Attempted to assemble invalid Assembly object.");
-	// Return the already assembled object, if present.
+	// Return the already assembled object, if present and it contains all requested data.
 	if (!m_assembledObject.bytecode.empty())
-		return m_assembledObject;
+	{
+		if (m_assembledWithDebugData || !_debugData)
+			return m_assembledObject;
+		// The object was assembled without the debug data before, assemble it again to get it.
+		m_assembledObject = {};
+	}
 
 	// Otherwise ensure the object is actually clear.
 	solRequire(m_assembledObject.linkReferences.empty(), AssemblyException, "Unexpected link references.");
@@ -1182,10 +1191,11 @@ LinkerObject const& Assembly::assemble() const
 	bool const eof = m_eofVersion.has_value();
 	solRequire(!eof || m_eofVersion == 1, AssemblyException, "Invalid EOF version.");
 
+	m_assembledWithDebugData = _debugData;
 	if (!eof)
-		return assembleLegacy();
+		return assembleLegacy(_debugData);
 	else
-		return assembleEOF();
+		return assembleEOF(_debugData);
 }
 
 [[nodiscard]] bytes Assembly::assembleOperation(AssemblyItem const& _item) const
@@ -1247,7 +1257,7 @@ LinkerObject const& Assembly::assemble() const
 	return _addJumpDest ? bytes(1, static_cast<uint8_t>(Instruction::JUMPDEST)) : bytes();
 }
 
-LinkerObject const& Assembly::assembleLegacy() const
+LinkerObject const& Assembly::assembleLegacy(bool _debugData) const
 {
 	solAssert(!m_eofVersion.has_value());
 	solAssert(!m_invalid);
@@ -1263,7 +1273,7 @@ LinkerObject const& Assembly::assembleLegacy() const
 	std::map<u256, LinkerObject::ImmutableRefs> immutableReferencesBySub;
 	for (auto const& sub: m_subs)
 	{
-		auto const& linkerObject = sub->assemble();
+		auto const& linkerObject = sub->assemble(_debugData);
 		if (!linkerObject.immutableReferences.empty())
 		{
 			assertThrow(
@@ -1317,7 +1327,7 @@ LinkerObject const& Assembly::assembleLegacy() const
 
 	unsigned bytesRequiredIncludingData = bytesRequiredForCode + 1 + static_cast<unsigned>(m_auxiliaryData.size());
 	for (auto const& sub: m_subs)
-		bytesRequiredIncludingData += static_cast<unsigned>(sub->assemble().bytecode.size());
+		bytesRequiredIncludingData += static_cast<unsigned>(sub->assemble(_debugData).bytecode.size());
 
 	unsigned bytesPerDataRef = numberEncodingSize(bytesRequiredIncludingData);
 	ret.bytecode.reserve(bytesRequiredIncludingData);
@@ -1330,12 +1340,17 @@ LinkerObject const& Assembly::assembleLegacy() const
 	uint8_t dataRefPush = static_cast<uint8_t>(pushInstruction(bytesPerDataRef));
 
 	LinkerObject::CodeSectionLocation codeSectionLocation;
-	codeSectionLocation.instructionLocations.reserve(items.size());
+	if (_debugData)
+		codeSectionLocation.instructionLocations.reserve(items.size());
 	codeSectionLocation.start = 0;
 	for (auto const& [assemblyItemIndex, item]: items | ranges::views::enumerate)
 	{
 		// collect instruction locations via side effects
-		InstructionLocationEmitter instructionLocationEmitter(codeSectionLocation.instructionLocations, ret.bytecode, assemblyItemIndex);
+		InstructionLocationEmitter instructionLocationEmitter(
+			_debugData ? &codeSectionLocation.instructionLocations : nullptr,
+			ret.bytecode,
+			assemblyItemIndex
+		);
 		// store position of the invalid jump destination
 		if (item.type() != Tag && m_tagPositionsInBytecode[0] == std::numeric_limits<size_t>::max())
 			m_tagPositionsInBytecode[0] = ret.bytecode.size();
@@ -1367,7 +1382,7 @@ LinkerObject const& Assembly::assembleLegacy() const
 		case PushSubSize:
 		{
 			solAssert(item.data() <= std::numeric_limits<SubAssemblyID::ValueType>::max());
-			auto s = subAssemblyById(SubAssemblyID{item.data()})->assemble().bytecode.size();
+			auto s = subAssemblyById(SubAssemblyID{item.data()})->assemble(_debugData).bytecode.size();
 			item.setPushedValue(u256(s));
 			unsigned b = std::max<unsigned>(1, numberEncodingSize(s));
 			ret.bytecode.push_back(static_cast<uint8_t>(pushInstruction(b)));
@@ -1447,7 +1462,8 @@ LinkerObject const& Assembly::assembleLegacy() const
 
 	codeSectionLocation.end = ret.bytecode.size();
 
-	ret.codeSectionLocations.emplace_back(std::move(codeSectionLocation));
+	if (_debugData)
+		ret.codeSectionLocations.emplace_back(std::move(codeSectionLocation));
 
 	if (!immutableReferencesBySub.empty())
 		throw
@@ -1464,7 +1480,7 @@ LinkerObject const& Assembly::assembleLegacy() const
 	std::map<LinkerObject, size_t> subAssemblyOffsets;
 	for (auto const& [subIdPath, bytecodeOffset]: subRefs)
 	{
-		LinkerObject subObject = subAssemblyById(subIdPath)->assemble();
+		LinkerObject subObject = subAssemblyById(subIdPath)->assemble(_debugData);
 		bytesRef r(ret.bytecode.data() + bytecodeOffset, bytesPerDataRef);
 
 		// In order for de-duplication to kick in, not only must the bytecode be identical, but
@@ -1495,24 +1511,26 @@ LinkerObject const& Assembly::assembleLegacy() const
 		bytesRef r(ret.bytecode.data() + i.first, bytesPerTag);
 		toBigEndian(pos, r);
 	}
-	for (auto const& [name, tagInfo]: m_namedTags)
-	{
-		size_t position = m_tagPositionsInBytecode.at(tagInfo.id);
-		std::optional<size_t> tagIndex;
-		for (auto&& [index, item]: items | ranges::views::enumerate)
-			if (item.type() == Tag && static_cast<size_t>(item.data()) == tagInfo.id)
-			{
-				tagIndex = index;
-				break;
-			}
-		ret.functionDebugData[name] = {
-			position == std::numeric_limits<size_t>::max() ? std::nullopt : std::optional<size_t>{position},
-			tagIndex,
-			tagInfo.sourceID,
-			tagInfo.params,
-			tagInfo.returns
-		};
-	}
+	// The function debug data is only needed for debugging and gas estimation.
+	if (_debugData)
+		for (auto const& [name, tagInfo]: m_namedTags)
+		{
+			size_t position = m_tagPositionsInBytecode.at(tagInfo.id);
+			std::optional<size_t> tagIndex;
+			for (auto&& [index, item]: items | ranges::views::enumerate)
+				if (item.type() == Tag && static_cast<size_t>(item.data()) == tagInfo.id)
+				{
+					tagIndex = index;
+					break;
+				}
+			ret.functionDebugData[name] = {
+				position == std::numeric_limits<size_t>::max() ? std::nullopt : std::optional<size_t>{position},
+				tagIndex,
+				tagInfo.sourceID,
+				tagInfo.params,
+				tagInfo.returns
+			};
+		}
 
 	for (auto const& dataItem: m_data)
 	{
@@ -1582,7 +1600,7 @@ std::optional<uint16_t> Assembly::findMaxAuxDataLoadNOffset() const
 	return maxOffset;
 }
 
-LinkerObject const& Assembly::assembleEOF() const
+LinkerObject const& Assembly::assembleEOF(bool _debugData) const
 {
 	solAssert(m_eofVersion.has_value() && m_eofVersion == 1);
 	LinkerObject& ret = m_assembledObject;
@@ -1599,7 +1617,7 @@ LinkerObject const& Assembly::assembleEOF() const
 	auto const maxAuxDataLoadNOffset = findMaxAuxDataLoadNOffset();
 
 	// Insert EOF1 header.
-	auto [headerBytecode, codeSectionSizePositions, dataSectionSizePosition] = createEOFHeader(referencedSubIds);
+	auto [headerBytecode, codeSectionSizePositions, dataSectionSizePosition] = createEOFHeader(referencedSubIds, _debugData);
 	ret.bytecode = headerBytecode;
 
 	m_tagPositionsInBytecode = std::vector<size_t>(m_usedTags, std::numeric_limits<size_t>::max());
@@ -1611,14 +1629,19 @@ LinkerObject const& Assembly::assembleEOF() const
 		auto const sectionStart = ret.bytecode.size();
 
 		std::vector<LinkerObject::InstructionLocation> instructionLocations;
-		instructionLocations.reserve(codeSection.items.size());
+		if (_debugData)
+			instructionLocations.reserve(codeSection.items.size());
 
 		solAssert(!codeSection.items.empty(), "Empty code section.");
 
 		for (auto const& [assemblyItemIndex, item]: codeSection.items | ranges::views::enumerate)
 		{
 			// collect instruction locations via side effects
-			InstructionLocationEmitter instructionLocationEmitter {instructionLocations, ret.bytecode, assemblyItemIndex};
+			InstructionLocationEmitter instructionLocationEmitter {
+				_debugData ? &instructionLocations : nullptr,
+				ret.bytecode,
+				assemblyItemIndex
+			};
 
 			// store position of the invalid jump destination
 			if (item.type() != Tag && m_tagPositionsInBytecode[0] == std::numeric_limits<size_t>::max())
@@ -1736,11 +1759,12 @@ LinkerObject const& Assembly::assembleEOF() const
 			);
 		setBigEndianUint16(ret.bytecode, codeSectionSizePositions[codeSectionIndex], ret.bytecode.size() - sectionStart);
 
-		ret.codeSectionLocations.push_back(LinkerObject::CodeSectionLocation{
-			.start = sectionStart,
-			.end = ret.bytecode.size(),
-			.instructionLocations = std::move(instructionLocations)
-		});
+		if (_debugData)
+			ret.codeSectionLocations.push_back(LinkerObject::CodeSectionLocation{
+				.start = sectionStart,
+				.end = ret.bytecode.size(),
+				.instructionLocations = std::move(instructionLocations)
+			});
 	}
 
 	for (auto const& [refPos, tagId]: tagRef)
@@ -1766,7 +1790,7 @@ LinkerObject const& Assembly::assembleEOF() const
 	for (auto i: referencedSubIds)
 	{
 		size_t const subAssemblyPositionInParentObject = ret.bytecode.size();
-		auto const& subAssemblyLinkerObject = m_subs[i]->assemble();
+		auto const& subAssemblyLinkerObject = m_subs[i]->assemble(_debugData);
 		// Append subassembly bytecode to the parent assembly result bytecode
 		ret.bytecode += subAssemblyLinkerObject.bytecode;
 		// Add subassembly link references to parent linker object.
@@ -1862,7 +1886,7 @@ Assembly const* Assembly::subAssemblyById(SubAssemblyID const _subId) const
 Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(frontend::OptimiserSettings const& _settings)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	OptimiserSettings asmSettings{false,  false, false, false, false, false, 0};
+	OptimiserSettings asmSettings{false,  false, false, false, false, false, 0, nullptr};
 	asmSettings.runInliner = _settings.runInliner;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
@@ -1870,5 +1894,7 @@ Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(front
 	asmSettings.runCSE = _settings.runCSE;
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
+	if (!_settings.executionProfile.empty())
+		asmSettings.executionProfile = std::make_shared<langutil::ExecutionProfile const>(_settings.executionProfile);
 	return asmSettings;
 }
@@ -161,7 +161,9 @@ public:
 	langutil::EVMVersion const& evmVersion() const { return m_evmVersion; }
 
 	/// Assembles the assembly into bytecode. The assembly should not be modified after this call, since the assembled version is cached.
-	LinkerObject const& assemble() const;
+	/// @param _debugData if false, the function debug data and the code section locations of the
+	/// result are left empty. Requesting them later assembles the object again.
+	LinkerObject const& assemble(bool _debugData = true) const;
 
 	struct OptimiserSettings
 	{
@@ -174,6 +176,8 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = frontend::OptimiserSettings{}.expectedExecutionsPerDeployment;
+		/// Recorded execution counts used to weight @a expectedExecutionsPerDeployment, if any.
+		std::shared_ptr<langutil::ExecutionProfile const> executionProfile;
 
 		static OptimiserSettings translateSettings(frontend::OptimiserSettings const& _settings);
 	};
@@ -273,10 +277,10 @@ private:
 	std::shared_ptr<std::string const> sharedSourceName(std::string const& _name) const;
 
 	/// Returns EOF header bytecode | code section sizes offsets | data section size offset
-	std::tuple<bytes, std::vector<size_t>, size_t> createEOFHeader(std::set<ContainerID> const& _referencedSubIds) const;
+	std::tuple<bytes, std::vector<size_t>, size_t> createEOFHeader(std::set<ContainerID> const& _referencedSubIds, bool _debugData) const;
 
-	LinkerObject const& assembleLegacy() const;
-	LinkerObject const& assembleEOF() const;
+	LinkerObject const& assembleLegacy(bool _debugData) const;
+	LinkerObject const& assembleEOF(bool _debugData) const;
 
 	/// Returns map from m_subs to an index of subcontainer in the final EOF bytecode
 	std::map<ContainerID, ContainerID> findReferencedContainers() const;
@@ -326,6 +330,8 @@ protected:
 	std::optional<std::map<u256, u256>> m_tagReplacements;
 
 	mutable LinkerObject m_assembledObject;
+	/// Whether @a m_assembledObject contains the function debug data and code section locations.
+	mutable bool m_assembledWithDebugData = false;
 	mutable std::vector<size_t> m_tagPositionsInBytecode;
 
 	langutil::EVMVersion m_evmVersion;
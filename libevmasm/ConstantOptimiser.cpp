@@ -24,6 +24,9 @@
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
 
+#include <mutex>
+#include <tuple>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 
@@ -31,7 +34,8 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 	bool _isCreation,
 	size_t _runs,
 	langutil::EVMVersion _evmVersion,
-	Assembly& _assembly
+	Assembly& _assembly,
+	langutil::ExecutionProfile const* _executionProfile
 )
 {
 	// TODO: design the optimiser in a way this is not needed
@@ -41,9 +45,17 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 		AssemblyItems& _items = codeSection.items;
 
 		std::map<AssemblyItem, size_t> pushes;
+		// Sum of the expected executions of all occurrences of a constant.
+		std::map<AssemblyItem, bigint> totalRuns;
 		for (AssemblyItem const& item: _items)
 			if (item.type() == Push)
+			{
 				pushes[item]++;
+				totalRuns[item] +=
+					_executionProfile && !_isCreation ?
+					_executionProfile->weightedRuns(item.location(), _runs) :
+					_runs;
+			}
 		std::map<u256, AssemblyItems> pendingReplacements;
 		for (auto it: pushes)
 		{
@@ -53,8 +65,9 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 			Params params;
 			params.multiplicity = it.second;
 			params.isCreation = _isCreation;
-			params.runs = _runs;
+			params.runs = static_cast<size_t>(totalRuns.at(item) / it.second);
 			params.evmVersion = _evmVersion;
+			params.eofVersion = _assembly.eofVersion();
 			LiteralMethod lit(params, item.data());
 			bigint literalGas = lit.gasNeeded();
 			CodeCopyMethod copy(params, item.data());
@@ -234,12 +247,34 @@ AssemblyItems CodeCopyMethod::copyRoutine(AssemblyItem* _pushData) const
 ComputeMethod::ComputeMethod(Params const& _params, u256 const& _value):
 	ConstantOptimisationMethod(_params, _value)
 {
+	// The routine only depends on the value and the parameters, share it between all
+	// assemblies in the process.
+	using Key = std::tuple<u256, bool, size_t, size_t, langutil::EVMVersion, std::optional<uint8_t>>;
+	static size_t constexpr maxCacheSize = 1 << 16;
+	static std::mutex mutex;
+	static std::map<Key, AssemblyItems> cache;
+
+	Key key{m_value, m_params.isCreation, m_params.runs, m_params.multiplicity, m_params.evmVersion, m_params.eofVersion};
+	{
+		std::lock_guard lock(mutex);
+		if (auto it = cache.find(key); it != cache.end())
+		{
+			m_routine = it->second;
+			return;
+		}
+	}
+
 	m_routine = findRepresentation(m_value);
 	assertThrow(
 		checkRepresentation(m_value, m_routine),
 		OptimizerException,
 		"Invalid constant expression created."
 	);
+
+	std::lock_guard lock(mutex);
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	cache.emplace(std::move(key), m_routine);
 }
 ComputeMethod::~ComputeMethod() = default;
 
@@ -25,10 +25,12 @@
 #include <libevmasm/Exceptions.h>
 
 #include <liblangutil/EVMVersion.h>
+#include <liblangutil/ExecutionProfile.h>
 
 #include <libsolutil/Numeric.h>
 #include <libsolutil/Assertions.h>
 
+#include <optional>
 #include <vector>
 
 namespace solidity::evmasm
@@ -46,12 +48,15 @@ class ConstantOptimisationMethod
 public:
 	/// Tries to optimised how constants are represented in the source code and modifies
 	/// @a _assembly.
+	/// If @a _executionProfile is given, the runs of each occurrence of a constant are weighted
+	/// by how often its source location was executed compared to the average.
 	/// @returns zero if no optimisations could be performed.
 	static unsigned optimiseConstants(
 		bool _isCreation,
 		size_t _runs,
 		langutil::EVMVersion _evmVersion,
-		Assembly& _assembly
+		Assembly& _assembly,
+		langutil::ExecutionProfile const* _executionProfile = nullptr
 	);
 
 protected:
@@ -63,6 +68,7 @@ protected:
 		size_t runs; ///< Estimated number of calls per opcode oven the lifetime of the contract.
 		size_t multiplicity; ///< Number of times the constant appears in the code.
 		langutil::EVMVersion evmVersion; ///< Version of the EVM
+		std::optional<uint8_t> eofVersion; ///< Version of EOF, if used
 	};
 
 	explicit ConstantOptimisationMethod(Params const& _params, u256 const& _value):
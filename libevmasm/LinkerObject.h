@@ -75,6 +75,7 @@ struct LinkerObject
 	/// Descriptions of all code sections in the ascending order of their positions.
 	/// There are no duplicates and the sections never overlap.
 	/// Only sections belonging to the top-level assembly are included, even if the bytecode contains subassemblies.
+	/// Empty if the object was assembled without debug data.
 	std::vector<CodeSectionLocation> codeSectionLocations;
 
 	struct FunctionDebugData
@@ -87,6 +88,7 @@ struct LinkerObject
 	};
 
 	/// Bytecode offsets of named tags like function entry points.
+	/// Empty if the object was assembled without debug data.
 	std::map<std::string, FunctionDebugData> functionDebugData;
 
 	/// Appends the bytecode of @a _other and incorporates its link references.
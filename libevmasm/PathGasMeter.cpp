@@ -89,11 +89,15 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 		AssemblyItem const& item = m_items.at(index);
 		if (item.type() == Tag || item == AssemblyItem(Instruction::JUMPDEST))
 		{
-			// Do not allow any backwards jump. This is quite restrictive but should work for
-			// the simplest things.
-			if (path->visitedJumpdests.count(index))
-				return GasMeter::GasConsumption::infinite();
-			path->visitedJumpdests.insert(index);
+			// Only follow a loop again if its iterations are determined by the known state.
+			// Otherwise it might be taken any number of times.
+			if (auto visit = path->visitedJumpdests.find(index); visit != path->visitedJumpdests.end())
+				if (
+					visit->second != path->undecidedBranches ||
+					++path->loopIterations > maxLoopIterations
+				)
+					return GasMeter::GasConsumption::infinite();
+			path->visitedJumpdests[index] = path->undecidedBranches;
 		}
 		else if (item == AssemblyItem(Instruction::JUMP))
 		{
@@ -101,6 +105,8 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 			jumpTags = state->tagsInExpression(state->relativeStackElement(0));
 			if (jumpTags.empty()) // unknown jump destination
 				return GasMeter::GasConsumption::infinite();
+			if (jumpTags.size() > 1)
+				++path->undecidedBranches;
 		}
 		else if (item == AssemblyItem(Instruction::JUMPI))
 		{
@@ -112,6 +118,8 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 					return GasMeter::GasConsumption::infinite();
 			}
 			branchStops = classes.knownNonZero(condition);
+			if (!branchStops && !classes.knownZero(condition))
+				++path->undecidedBranches;
 		}
 		else if (SemanticInformation::altersControlFlow(item))
 			branchStops = true;
@@ -128,6 +136,8 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 			newPath->largestMemoryAccess = meter.largestMemoryAccess();
 			newPath->state = state->copy();
 			newPath->visitedJumpdests = path->visitedJumpdests;
+			newPath->undecidedBranches = path->undecidedBranches;
+			newPath->loopIterations = path->loopIterations;
 			queue(std::move(newPath));
 		}
 
@@ -26,7 +26,7 @@
 
 #include <liblangutil/EVMVersion.h>
 
-#include <set>
+#include <map>
 #include <vector>
 #include <memory>
 
@@ -41,17 +41,29 @@ struct GasPath
 	std::shared_ptr<KnownState> state;
 	u256 largestMemoryAccess;
 	GasMeter::GasConsumption gas;
-	std::set<size_t> visitedJumpdests;
+	/// Jumpdests visited on this path, with the value of @a undecidedBranches at the last visit.
+	std::map<size_t, size_t> visitedJumpdests;
+	/// Number of conditional jumps on this path whose condition was not known.
+	size_t undecidedBranches = 0;
+	/// Number of times a jumpdest was visited again on this path, i.e. of loop iterations.
+	size_t loopIterations = 0;
 };
 
 /**
  * Computes an upper bound on the gas usage of a computation starting at a certain position in
  * a list of AssemblyItems in a given state until the computation stops.
  * Can be used to estimate the gas usage of functions on any given input.
+ *
+ * Loops are followed iteration by iteration as long as all branches taken since the previous
+ * iteration were decided by the known state, i.e. if the number of iterations only depends on
+ * constants. Other loops, and loops with more than @a maxLoopIterations iterations in total,
+ * result in an infinite estimate.
  */
 class PathGasMeter
 {
 public:
+	static size_t constexpr maxLoopIterations = 1024;
+
 	explicit PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion);
 
 	GasMeter::GasConsumption estimateMax(size_t _startIndex, std::shared_ptr<KnownState> const& _state);
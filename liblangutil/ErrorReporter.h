@@ -53,6 +53,11 @@ public:
 		m_errorList += _errorList;
 	}
 
+	/// Reports errors collected by another reporter as if they had been reported to this one,
+	/// i.e. they count towards the limits on the number of errors, warnings and infos.
+	/// @throws FatalError if there are too many errors.
+	void report(ErrorList const& _errorList);
+
 	void warning(ErrorId _error, std::string const& _description);
 
 	void warning(ErrorId _error, SourceLocation const& _location, std::string const& _description);
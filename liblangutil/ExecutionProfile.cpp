@@ -0,0 +1,219 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <liblangutil/ExecutionProfile.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+
+using namespace solidity;
+using namespace solidity::langutil;
+
+namespace
+{
+
+bool isNonNegativeInteger(Json const& _value)
+{
+	return _value.is_number_unsigned() || (_value.is_number_integer() && _value.get<int64_t>() >= 0);
+}
+
+uint64_t parseCount(Json const& _value, std::string const& _context)
+{
+	if (!isNonNegativeInteger(_value))
+		solThrow(ProfileDataError, _context + " must be an unsigned number.");
+	return _value.get<uint64_t>();
+}
+
+int parseOffset(Json const& _value, std::string const& _context)
+{
+	if (!isNonNegativeInteger(_value) || _value.get<uint64_t>() > uint64_t(std::numeric_limits<int>::max()))
+		solThrow(ProfileDataError, _context + " must be a valid source offset.");
+	return static_cast<int>(_value.get<uint64_t>());
+}
+
+}
+
+ExecutionProfile::ExecutionProfile(
+	std::map<uint32_t, uint64_t> _selectorCounts,
+	std::map<std::string, std::vector<LocationCount>> _locationCounts
+):
+	m_selectorCounts(std::move(_selectorCounts)),
+	m_locationCounts(std::move(_locationCounts))
+{
+	double total = 0;
+	size_t numLocations = 0;
+	for (auto const& locations: m_locationCounts)
+		for (LocationCount const& location: locations.second)
+		{
+			total += static_cast<double>(location.count);
+			++numLocations;
+		}
+	if (numLocations > 0)
+		m_meanLocationCount = total / static_cast<double>(numLocations);
+}
+
+ExecutionProfile ExecutionProfile::fromJson(Json const& _input)
+{
+	if (!_input.is_object())
+		solThrow(ProfileDataError, "Profile data must be a JSON object.");
+	for (auto const& [key, value]: _input.items())
+		if (key != "selectors" && key != "sourceLocations")
+			solThrow(ProfileDataError, "Unknown key in profile data: \"" + key + "\".");
+
+	std::map<uint32_t, uint64_t> selectorCounts;
+	if (_input.contains("selectors"))
+	{
+		if (!_input["selectors"].is_object())
+			solThrow(ProfileDataError, "\"selectors\" must be an object mapping function selectors to call counts.");
+		for (auto const& [selector, count]: _input["selectors"].items())
+		{
+			if (
+				selector.size() != 8 ||
+				!std::all_of(selector.begin(), selector.end(), [](char _c) {
+					return std::isxdigit(static_cast<unsigned char>(_c));
+				})
+			)
+				solThrow(
+					ProfileDataError,
+					"Invalid function selector in profile data: \"" + selector + "\". Expected 8 hexadecimal digits."
+				);
+			selectorCounts[static_cast<uint32_t>(std::stoul(selector, nullptr, 16))] +=
+				parseCount(count, "Call count of selector " + selector);
+		}
+	}
+
+	std::map<std::string, std::vector<LocationCount>> locationCounts;
+	if (_input.contains("sourceLocations"))
+	{
+		if (!_input["sourceLocations"].is_array())
+			solThrow(ProfileDataError, "\"sourceLocations\" must be an array.");
+		for (Json const& entry: _input["sourceLocations"])
+		{
+			if (
+				!entry.is_object() ||
+				!entry.contains("source") ||
+				!entry["source"].is_string() ||
+				!entry.contains("start") ||
+				!entry.contains("end") ||
+				!entry.contains("count")
+			)
+				solThrow(
+					ProfileDataError,
+					"Each entry of \"sourceLocations\" must be an object with the fields "
+					"\"source\", \"start\", \"end\" and \"count\"."
+				);
+			LocationCount location{
+				parseOffset(entry["start"], "\"start\""),
+				parseOffset(entry["end"], "\"end\""),
+				parseCount(entry["count"], "\"count\"")
+			};
+			if (location.end < location.start)
+				solThrow(ProfileDataError, "Source range in profile data ends before it starts.");
+			locationCounts[entry["source"].get<std::string>()].emplace_back(location);
+		}
+	}
+
+	return ExecutionProfile{std::move(selectorCounts), std::move(locationCounts)};
+}
+
+Json ExecutionProfile::toJson() const
+{
+	Json result = Json::object();
+	if (!m_selectorCounts.empty())
+	{
+		result["selectors"] = Json::object();
+		for (auto const& [selector, count]: m_selectorCounts)
+			result["selectors"][fmt::format("{:08x}", selector)] = count;
+	}
+	if (!m_locationCounts.empty())
+	{
+		result["sourceLocations"] = Json::array();
+		for (auto const& [source, locations]: m_locationCounts)
+			for (LocationCount const& location: locations)
+				result["sourceLocations"].emplace_back(Json{
+					{"source", source},
+					{"start", location.start},
+					{"end", location.end},
+					{"count", location.count}
+				});
+	}
+	return result;
+}
+
+std::vector<uint32_t> ExecutionProfile::dispatchOrder(std::set<uint32_t> const& _selectors) const
+{
+	std::vector<std::pair<uint32_t, double>> calls;
+	double remaining = 0;
+	for (uint32_t selector: _selectors)
+		if (auto it = m_selectorCounts.find(selector); it != m_selectorCounts.end() && it->second > 0)
+		{
+			calls.emplace_back(selector, static_cast<double>(it->second));
+			remaining += static_cast<double>(it->second);
+		}
+	std::stable_sort(calls.begin(), calls.end(), [](auto const& _a, auto const& _b) {
+		return _a.second > _b.second;
+	});
+
+	// Finding a selector without the hint takes about log2(n) comparisons (a binary search),
+	// checking it first takes one but adds one comparison to each call of the selectors after it.
+	double const comparisonsSaved = std::max(1.0, std::ceil(std::log2(static_cast<double>(_selectors.size()))));
+	std::vector<uint32_t> order;
+	for (auto const& [selector, count]: calls)
+	{
+		if (count * comparisonsSaved <= remaining - count)
+			break;
+		order.emplace_back(selector);
+		remaining -= count;
+	}
+	return order;
+}
+
+std::optional<double> ExecutionProfile::relativeFrequency(SourceLocation const& _location) const
+{
+	if (!_location.hasText() || m_meanLocationCount <= 0)
+		return std::nullopt;
+	auto locations = m_locationCounts.find(*_location.sourceName);
+	if (locations == m_locationCounts.end())
+		return std::nullopt;
+
+	LocationCount const* innermost = nullptr;
+	for (LocationCount const& location: locations->second)
+		if (
+			location.start <= _location.start &&
+			_location.end <= location.end &&
+			(!innermost || location.end - location.start < innermost->end - innermost->start)
+		)
+			innermost = &location;
+	if (!innermost)
+		return std::nullopt;
+	return static_cast<double>(innermost->count) / m_meanLocationCount;
+}
+
+size_t ExecutionProfile::weightedRuns(SourceLocation const& _location, size_t _runs) const
+{
+	std::optional<double> frequency = relativeFrequency(_location);
+	if (!frequency)
+		return _runs;
+	// Same upper bound as the one for the number of runs accepted by the compiler interfaces.
+	double const maxRuns = static_cast<double>(std::numeric_limits<uint32_t>::max());
+	return static_cast<size_t>(std::clamp(std::round(static_cast<double>(_runs) * *frequency), 1.0, maxRuns));
+}
@@ -0,0 +1,103 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Execution counts recorded from real transactions, used for profile-guided optimisation.
+ */
+
+#pragma once
+
+#include <liblangutil/SourceLocation.h>
+
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/JSON.h>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace solidity::langutil
+{
+
+struct ProfileDataError: virtual util::Exception {};
+
+/**
+ * Execution counts of a deployed contract, e.g. extracted from transaction traces and mapped
+ * back to the sources via the source mappings.
+ *
+ * Contains the number of calls per function selector and, optionally, the number of
+ * executions of code belonging to a source range. The absolute values do not matter, the
+ * optimiser only uses them relative to each other.
+ *
+ * JSON representation:
+ * {
+ *   "selectors": {"a9059cbb": 1500, "70a08231": 300},
+ *   "sourceLocations": [{"source": "token.sol", "start": 120, "end": 180, "count": 4200}]
+ * }
+ */
+class ExecutionProfile
+{
+public:
+	struct LocationCount
+	{
+		int start = -1;
+		int end = -1;
+		uint64_t count = 0;
+
+		bool operator==(LocationCount const& _other) const = default;
+	};
+
+	ExecutionProfile() = default;
+	ExecutionProfile(
+		std::map<uint32_t, uint64_t> _selectorCounts,
+		std::map<std::string, std::vector<LocationCount>> _locationCounts
+	);
+
+	/// @throws ProfileDataError if @a _input is not a valid profile.
+	static ExecutionProfile fromJson(Json const& _input);
+	Json toJson() const;
+
+	bool empty() const { return m_selectorCounts.empty() && m_locationCounts.empty(); }
+	bool operator==(ExecutionProfile const& _other) const = default;
+
+	std::map<uint32_t, uint64_t> const& selectorCounts() const { return m_selectorCounts; }
+
+	/// @returns the selectors out of @a _selectors that a dispatcher should check first, in
+	/// that order. A selector is only included if its calls save more comparisons than the
+	/// additional check costs for the calls of all selectors that come after it.
+	std::vector<uint32_t> dispatchOrder(std::set<uint32_t> const& _selectors) const;
+
+	/// @returns how often the code at @a _location is executed compared to the average of
+	/// all recorded source ranges, using the innermost recorded range that contains it,
+	/// or nullopt if there is no such range.
+	std::optional<double> relativeFrequency(SourceLocation const& _location) const;
+
+	/// @returns @a _runs scaled by the relative frequency of the code at @a _location,
+	/// or @a _runs if the profile has no information about it. Never returns zero.
+	size_t weightedRuns(SourceLocation const& _location, size_t _runs) const;
+
+private:
+	std::map<uint32_t, uint64_t> m_selectorCounts;
+	/// Recorded source ranges, by source unit name.
+	std::map<std::string, std::vector<LocationCount>> m_locationCounts;
+	double m_meanLocationCount = 0;
+};
+
+}
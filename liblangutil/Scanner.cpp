@@ -247,11 +247,14 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 
 bool Scanner::skipWhitespace()
 {
-	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
-	// Return whether or not we skipped any characters.
-	return sourcePos() != startPosition;
+	// The current character is not necessarily the one at the current position in the source,
+	// see skipMultiLineComment.
+	if (!isWhiteSpace(m_char))
+		return false;
+	// Skip the rest of the run directly in the source. These are the characters of isWhiteSpace.
+	std::string_view const source = m_source.source();
+	m_char = m_source.setPosition(std::min(source.find_first_not_of(" \n\t\r", sourcePos() + 1), source.size()));
+	return true;
 }
 
 bool Scanner::skipWhitespaceExceptUnicodeLinebreak()
@@ -267,6 +270,35 @@ bool Scanner::skipWhitespaceExceptUnicodeLinebreak()
 namespace
 {
 
+/// The bytes that can start a line terminator recognized by Scanner::isUnicodeLinebreak,
+/// i.e. everything else can be skipped without further checks.
+std::string_view const unicodeLinebreakStarts{"\n\v\f\r\xC2\xE2"};
+
+/// @returns true if @a _c is one of unicodeLinebreakStarts.
+bool mayStartUnicodeLinebreak(char _c)
+{
+	return unicodeLinebreakStarts.find(_c) != std::string_view::npos;
+}
+
+/// @returns the position of the first byte in @a _source at or after @a _position that may
+/// start a line terminator, or the size of @a _source if there is none.
+size_t findUnicodeLinebreakStart(std::string_view _source, size_t _position)
+{
+	return std::min(_source.find_first_of(unicodeLinebreakStarts, _position), _source.size());
+}
+
+/// @returns true if @a _c can be added to a string literal delimited by @a _quote without
+/// any further checks, i.e. it neither ends the literal nor starts an escape sequence and
+/// is allowed in the kind of literal.
+bool isPlainStringCharacter(char _c, char _quote, bool _isUnicode)
+{
+	if (_c == _quote || _c == '\\')
+		return false;
+	if (0x20 <= _c && _c < 0x7f)
+		return true;
+	return _isUnicode && uint8_t(_c) >= 0x7f && !mayStartUnicodeLinebreak(_c);
+}
+
 /// Tries to scan for an RLO/LRO/RLE/LRE/PDF and keeps track of script writing direction override depth.
 ///
 /// @returns ScannerError::NoError in case of successful parsing and directional encodings are paired
@@ -282,25 +314,32 @@ static ScannerError validateBiDiMarkup(CharStream& _stream, size_t _startPositio
 		std::pair<std::string_view, int>{"\xE2\x80\xAC", -1} // U+202C (PDF - Pop Directional Formatting
 	};
 
-	size_t endPosition = _stream.position();
-	_stream.setPosition(_startPosition);
+	std::string_view const source = _stream.source();
+	size_t const endPosition = _stream.position();
 
 	int directionOverrideDepth = 0;
 
-	for (size_t currentPos = _startPosition; currentPos < endPosition; ++currentPos)
+	// All sequences start with the same byte, so only its occurrences have to be inspected.
+	std::string_view const checkedRange = source.substr(0, endPosition);
+	for (
+		size_t currentPos = checkedRange.find('\xE2', _startPosition);
+		currentPos != std::string_view::npos;
+		currentPos = checkedRange.find('\xE2', currentPos + 1)
+	)
 	{
-		_stream.setPosition(currentPos);
-
 		for (auto const& [sequence, depthChange]: directionalSequences)
-			if (_stream.prefixMatch(sequence))
+			// Same bounds as CharStream::prefixMatch, which requires a character after the sequence.
+			if (currentPos + sequence.size() < source.size() && source.substr(currentPos, sequence.size()) == sequence)
 				directionOverrideDepth += depthChange;
 
 		if (directionOverrideDepth < 0)
+		{
+			// Report the error at the unmatched sequence.
+			_stream.setPosition(currentPos);
 			return ScannerError::DirectionalOverrideUnderflow;
+		}
 	}
 
-	_stream.setPosition(endPosition);
-
 	return directionOverrideDepth > 0 ? ScannerError::DirectionalOverrideMismatch : ScannerError::NoError;
 }
 
@@ -311,9 +350,8 @@ Token Scanner::skipSingleLineComment()
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source.position();
-	while (!isUnicodeLinebreak())
-		if (!advance())
-			break;
+	while (!isSourcePastEndOfInput() && !isUnicodeLinebreak())
+		m_char = m_source.setPosition(findUnicodeLinebreakStart(m_source.source(), sourcePos() + 1));
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -383,6 +421,15 @@ size_t Scanner::scanSingleLineDocComment()
 			break;
 		addCommentLiteralChar(m_char);
 		advance();
+		// Add the rest of the line at once.
+		std::string_view const source = m_source.source();
+		size_t const position = findUnicodeLinebreakStart(source, sourcePos());
+		if (position != sourcePos())
+		{
+			m_skippedComments[NextNext].literal.append(source.substr(sourcePos(), position - sourcePos()));
+			endPosition = position - 1;
+			m_char = m_source.setPosition(position);
+		}
 	}
 	literal.complete();
 	return endPosition;
@@ -391,26 +438,24 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source.position();
-	while (!isSourcePastEndOfInput())
+	size_t const terminatorPosition = std::string_view(m_source.source()).find("*/", startPosition);
+	if (terminatorPosition == std::string_view::npos)
 	{
-		char prevChar = m_char;
-		advance();
+		// Unterminated multi-line comment.
+		m_char = m_source.setPosition(m_source.source().size());
+		return setError(ScannerError::IllegalCommentTerminator);
+	}
 
-		// If we have reached the end of the multi-line comment, we
-		// consume the '/' and insert a whitespace. This way all
-		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
-		{
-			ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
-			if (unicodeDirectionError != ScannerError::NoError)
-				return setError(unicodeDirectionError);
+	// We have reached the end of the multi-line comment, we
+	// consume the '/' and insert a whitespace. This way all
+	// multi-line comments are treated as whitespace.
+	m_char = m_source.setPosition(terminatorPosition + 1);
+	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
+	if (unicodeDirectionError != ScannerError::NoError)
+		return setError(unicodeDirectionError);
 
-			m_char = ' ';
-			return Token::Whitespace;
-		}
-	}
-	// Unterminated multi-line comment.
-	return setError(ScannerError::IllegalCommentTerminator);
+	m_char = ' ';
+	return Token::Whitespace;
 }
 
 Token Scanner::scanMultiLineDocComment()
@@ -460,6 +505,11 @@ Token Scanner::scanMultiLineDocComment()
 		addCommentLiteralChar(m_char);
 		charsAdded = true;
 		advance();
+		// Add everything up to the next line break or potential end of the comment at once.
+		std::string_view const source = m_source.source();
+		size_t const position = std::min(source.find_first_of("\n\r*", sourcePos()), source.size());
+		m_skippedComments[NextNext].literal.append(source.substr(sourcePos(), position - sourcePos()));
+		m_char = m_source.setPosition(position);
 	}
 	literal.complete();
 	if (!endFound)
@@ -829,6 +879,21 @@ Token Scanner::scanString(bool const _isUnicode)
 	// for source location comments we allow multiline string literals
 	while (m_char != quote && !isSourcePastEndOfInput() && (!isUnicodeLinebreak() || m_kind == ScannerKind::SpecialComment))
 	{
+		if (m_kind != ScannerKind::SpecialComment)
+		{
+			// Add runs of characters that need neither escaping nor further checks at once.
+			std::string const& source = m_source.source();
+			size_t position = sourcePos();
+			while (position < source.size() && isPlainStringCharacter(source[position], quote, _isUnicode))
+				++position;
+			if (position != sourcePos())
+			{
+				m_tokens[NextNext].literal.append(source, sourcePos(), position - sourcePos());
+				m_char = m_source.setPosition(position);
+				continue;
+			}
+		}
+
 		char c = m_char;
 		advance();
 
@@ -890,8 +955,24 @@ Token Scanner::scanHexString()
 	advance();  // consume quote
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	bool allowUnderscore = false;
+	std::string const& source = m_source.source();
 	while (m_char != quote && !isSourcePastEndOfInput())
 	{
+		// Convert runs of complete hex bytes directly from the source.
+		size_t position = sourcePos();
+		if (position + 1 < source.size() && isHexDigit(source[position]) && isHexDigit(source[position + 1]))
+		{
+			do
+			{
+				addLiteralChar(static_cast<char>(hexValue(source[position]) * 16 + hexValue(source[position + 1])));
+				position += 2;
+			}
+			while (position + 1 < source.size() && isHexDigit(source[position]) && isHexDigit(source[position + 1]));
+			m_char = m_source.setPosition(position);
+			allowUnderscore = true;
+			continue;
+		}
+
 		char c = m_char;
 
 		if (scanHexByte(c))
@@ -1031,10 +1112,17 @@ std::tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
-	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	// Find the end of the identifier in the source and add it at once.
+	std::string const& source = m_source.source();
+	size_t const startPosition = sourcePos();
+	size_t position = startPosition + 1;
+	while (
+		position < source.size() &&
+		(isIdentifierPart(source[position]) || (source[position] == '.' && m_kind == ScannerKind::Yul))
+	)
+		++position;
+	m_tokens[NextNext].literal.append(source, startPosition, position - startPosition);
+	m_char = m_source.setPosition(position);
 	literal.complete();
 
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
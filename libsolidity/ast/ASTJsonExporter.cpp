@@ -201,7 +201,46 @@ Json ASTJsonExporter::inlineAssemblyIdentifierToJson(std::pair<yul::Identifier c
 
 void ASTJsonExporter::print(std::ostream& _stream, ASTNode const& _node, util::JsonFormat const& _format)
 {
-	_stream << util::jsonPrint(toJson(_node), _format);
+	util::JsonStreamWriter writer(_stream, _format);
+	write(writer, _node);
+}
+
+void ASTJsonExporter::write(util::JsonStreamWriter& _writer, ASTNode const& _node)
+{
+	std::vector<ASTPointer<ASTNode>> nodes;
+	if (auto const* sourceUnit = dynamic_cast<SourceUnit const*>(&_node))
+		nodes = sourceUnit->nodes();
+	else if (auto const* contract = dynamic_cast<ContractDefinition const*>(&_node))
+		nodes = contract->subNodes();
+	else
+	{
+		_writer.value(toJson(_node));
+		return;
+	}
+
+	m_omitNodes = true;
+	Json json = toJson(_node);
+	solAssert(!m_omitNodes);
+
+	// Members are iterated in the same order as they are printed by jsonPrint.
+	_writer.beginObject();
+	for (auto const& [name, value]: json.items())
+	{
+		_writer.key(name);
+		if (name != "nodes")
+		{
+			_writer.value(value);
+			continue;
+		}
+		_writer.beginArray();
+		for (auto const& node: nodes)
+			if (node)
+				write(_writer, *node);
+			else
+				_writer.value(Json());
+		_writer.endArray();
+	}
+	_writer.endObject();
 }
 
 Json ASTJsonExporter::toJson(ASTNode const& _node)
@@ -219,9 +258,10 @@ Json ASTJsonExporter::toJson(ASTNode const* _node)
 
 bool ASTJsonExporter::visit(SourceUnit const& _node)
 {
+	bool const omitNodes = std::exchange(m_omitNodes, false);
 	std::vector<std::pair<std::string, Json>> attributes = {
 		std::make_pair("license", _node.licenseString() ? Json(*_node.licenseString()) : Json()),
-		std::make_pair("nodes", toJson(_node.nodes())),
+		std::make_pair("nodes", omitNodes ? Json::array() : toJson(_node.nodes())),
 	};
 
 	if (_node.experimentalSolidity())
@@ -296,6 +336,7 @@ bool ASTJsonExporter::visit(StorageLayoutSpecifier const& _node)
 
 bool ASTJsonExporter::visit(ContractDefinition const& _node)
 {
+	bool const omitNodes = std::exchange(m_omitNodes, false);
 	std::vector<std::pair<std::string, Json>> attributes = {
 		std::make_pair("name", _node.name()),
 		std::make_pair("nameLocation", sourceLocationToString(_node.nameLocation())),
@@ -307,7 +348,7 @@ bool ASTJsonExporter::visit(ContractDefinition const& _node)
 		// Do not require call graph because the AST is also created for incorrect sources.
 		std::make_pair("usedEvents", getContainerIds(_node.interfaceEvents(false))),
 		std::make_pair("usedErrors", getContainerIds(_node.interfaceErrors(false))),
-		std::make_pair("nodes", toJson(_node.subNodes())),
+		std::make_pair("nodes", omitNodes ? Json::array() : toJson(_node.subNodes())),
 		std::make_pair("scope", idOrNull(_node.scope())),
 		std::make_pair("storageLayout", toJson(_node.storageLayoutSpecifier()))
 	};
@@ -58,7 +58,13 @@ public:
 		std::map<std::string, unsigned> _sourceIndices = std::map<std::string, unsigned>()
 	);
 	/// Output the json representation of the AST to _stream.
+	/// The members of source units and contracts are converted and written one at a time, so the
+	/// JSON tree of the whole AST is never held in memory. The output is the same as the one of
+	/// @a toJson printed with @a _format.
 	void print(std::ostream& _stream, ASTNode const& _node, util::JsonFormat const& _format);
+	/// Writes the json representation of the AST as the next value of @a _writer, in the same way
+	/// as @a print.
+	void write(util::JsonStreamWriter& _writer, ASTNode const& _node);
 	Json toJson(ASTNode const& _node);
 	Json toJson(ASTNode const* _node);
 	template <class T>
@@ -199,6 +205,9 @@ private:
 
 	CompilerStack::State m_stackState = CompilerStack::State::Empty; ///< Used to only access information that already exists
 	bool m_inEvent = false; ///< whether we are currently inside an event or not
+	/// Whether the next visited source unit or contract is converted with an empty "nodes" array
+	/// because @a write streams its members.
+	bool m_omitNodes = false;
 	Json m_currentValue;
 	std::map<std::string, unsigned> m_sourceIndices;
 };
@@ -56,15 +56,16 @@ ASTPointer<T> ASTJsonImporter::nullOrCast(Json const& _json)
 
 // ============ public ===========================
 
-std::map<std::string, ASTPointer<SourceUnit>> ASTJsonImporter::jsonToSourceUnit(std::map<std::string, Json> const& _sourceList)
+std::map<std::string, ASTPointer<SourceUnit>> ASTJsonImporter::jsonToSourceUnit(std::map<std::string, Json> _sourceList)
 {
 	for (auto const& src: _sourceList)
 		m_sourceNames.emplace_back(std::make_shared<std::string const>(src.first));
-	for (auto const& srcPair: _sourceList)
+	for (auto& srcPair: _sourceList)
 	{
 		astAssert(!srcPair.second.is_null());
 		astAssert(member(srcPair.second,"nodeType") == "SourceUnit", "The 'nodeType' of the highest node must be 'SourceUnit'.");
 		m_sourceUnits[srcPair.first] = createSourceUnit(srcPair.second, srcPair.first);
+		srcPair.second = Json();
 	}
 	return m_sourceUnits;
 }
@@ -1106,11 +1107,13 @@ ASTPointer<StructuredDocumentation> ASTJsonImporter::createDocumentation(Json co
 
 // ===== helper functions ==========
 
-Json ASTJsonImporter::member(Json const& _node, std::string const& _name)
+Json const& ASTJsonImporter::member(Json const& _node, std::string const& _name)
 {
-	if (!_node.contains(_name))
-		return Json();
-	return _node[_name];
+	static Json const null;
+	auto it = _node.find(_name);
+	if (it == _node.end())
+		return null;
+	return *it;
 }
 
 Token ASTJsonImporter::scanSingleToken(Json const& _node)
@@ -1128,14 +1131,14 @@ ASTPointer<ASTString> ASTJsonImporter::nullOrASTString(Json const& _json, std::s
 
 ASTPointer<ASTString> ASTJsonImporter::memberAsASTString(Json const& _node, std::string const& _name)
 {
-	Json value = member(_node, _name);
+	Json const& value = member(_node, _name);
 	astAssert(value.is_string(), "field " + _name + " must be of type string.");
 	return std::make_shared<ASTString>(_node[_name].get<std::string>());
 }
 
 bool ASTJsonImporter::memberAsBool(Json const& _node, std::string const& _name)
 {
-	Json value = member(_node, _name);
+	Json const& value = member(_node, _name);
 	astAssert(value.is_boolean(), "field " + _name + " must be of type boolean.");
 	return _node[_name].get<bool>();
 }
@@ -1179,7 +1182,7 @@ Token ASTJsonImporter::literalTokenKind(Json const& _node)
 
 Visibility ASTJsonImporter::visibility(Json const& _node)
 {
-	Json visibility = member(_node, "visibility");
+	Json const& visibility = member(_node, "visibility");
 	astAssert(visibility.is_string(), "'visibility' expected to be a string.");
 
 	std::string const visibilityStr = visibility.get<std::string>();
@@ -1203,7 +1206,7 @@ Visibility ASTJsonImporter::visibility(Json const& _node)
 
 VariableDeclaration::Location ASTJsonImporter::location(Json const& _node)
 {
-	Json storageLoc = member(_node, "storageLocation");
+	Json const& storageLoc = member(_node, "storageLocation");
 	astAssert(storageLoc.is_string(), "'storageLocation' expected to be a string.");
 
 	std::string const storageLocStr = storageLoc.get<std::string>();
@@ -1227,7 +1230,7 @@ VariableDeclaration::Location ASTJsonImporter::location(Json const& _node)
 
 Literal::SubDenomination ASTJsonImporter::subdenomination(Json const& _node)
 {
-	Json subDen = member(_node, "subdenomination");
+	Json const& subDen = member(_node, "subdenomination");
 
 	if (subDen.is_null())
 		return Literal::SubDenomination::None;
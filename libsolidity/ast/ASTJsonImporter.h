@@ -45,9 +45,10 @@ public:
 	{}
 
 	/// Converts the AST from JSON-format to ASTPointer
-	/// @a _sourceList used to provide source names for the ASTs
+	/// @a _sourceList used to provide source names for the ASTs. The JSON of each source is released
+	/// as soon as it is converted, so that the JSON and the AST of all sources are not held at once.
 	/// @returns map of sourcenames to their respective ASTs
-	std::map<std::string, ASTPointer<SourceUnit>> jsonToSourceUnit(std::map<std::string, Json> const& _sourceList);
+	std::map<std::string, ASTPointer<SourceUnit>> jsonToSourceUnit(std::map<std::string, Json> _sourceList);
 
 private:
 
@@ -136,7 +137,8 @@ private:
 
 	// =============== general helper functions ===================
 	/// @returns the member of a given JSON object or null if member does not exist
-	Json member(Json const& _node, std::string const& _name);
+	/// Returns a reference to avoid copying the subtree of every visited node.
+	Json const& member(Json const& _node, std::string const& _name);
 	/// @returns the appropriate TokenObject used in parsed Strings (pragma directive or operator)
 	Token scanSingleToken(Json const& _node);
 	template<class T>
@@ -28,6 +28,8 @@ using namespace solidity::util;
 BoolType const TypeProvider::m_boolean{};
 InaccessibleDynamicType const TypeProvider::m_inaccessibleDynamic{};
 
+std::mutex TypeProvider::m_mutex;
+
 /// The string and bytes unique_ptrs are initialized when they are first used because
 /// they rely on `byte` being available which we cannot guarantee in the static init context.
 std::unique_ptr<ArrayType> TypeProvider::m_bytesStorage;
@@ -200,8 +202,12 @@ void TypeProvider::reset()
 template <typename T, typename... Args>
 inline T const* TypeProvider::createAndGet(Args&& ... _args)
 {
-	instance().m_generalTypes.emplace_back(std::make_unique<T>(std::forward<Args>(_args)...));
-	return static_cast<T const*>(instance().m_generalTypes.back().get());
+	// Types can request other types during construction, so only the insertion is guarded.
+	auto type = std::make_unique<T>(std::forward<Args>(_args)...);
+	T const* result = type.get();
+	std::lock_guard lock(m_mutex);
+	instance().m_generalTypes.emplace_back(std::move(type));
+	return result;
 }
 
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
@@ -306,6 +312,7 @@ Type const* TypeProvider::fromElementaryTypeName(std::string const& _name)
 
 ArrayType const* TypeProvider::bytesStorage()
 {
+	std::lock_guard lock(m_mutex);
 	if (!m_bytesStorage)
 		m_bytesStorage = std::make_unique<ArrayType>(DataLocation::Storage, false);
 	return m_bytesStorage.get();
@@ -313,6 +320,7 @@ ArrayType const* TypeProvider::bytesStorage()
 
 ArrayType const* TypeProvider::bytesMemory()
 {
+	std::lock_guard lock(m_mutex);
 	if (!m_bytesMemory)
 		m_bytesMemory = std::make_unique<ArrayType>(DataLocation::Memory, false);
 	return m_bytesMemory.get();
@@ -320,6 +328,7 @@ ArrayType const* TypeProvider::bytesMemory()
 
 ArrayType const* TypeProvider::bytesCalldata()
 {
+	std::lock_guard lock(m_mutex);
 	if (!m_bytesCalldata)
 		m_bytesCalldata = std::make_unique<ArrayType>(DataLocation::CallData, false);
 	return m_bytesCalldata.get();
@@ -327,6 +336,7 @@ ArrayType const* TypeProvider::bytesCalldata()
 
 ArrayType const* TypeProvider::stringStorage()
 {
+	std::lock_guard lock(m_mutex);
 	if (!m_stringStorage)
 		m_stringStorage = std::make_unique<ArrayType>(DataLocation::Storage, true);
 	return m_stringStorage.get();
@@ -334,6 +344,7 @@ ArrayType const* TypeProvider::stringStorage()
 
 ArrayType const* TypeProvider::stringMemory()
 {
+	std::lock_guard lock(m_mutex);
 	if (!m_stringMemory)
 		m_stringMemory = std::make_unique<ArrayType>(DataLocation::Memory, true);
 	return m_stringMemory.get();
@@ -378,6 +389,7 @@ RationalNumberType const* TypeProvider::rationalNumber(Literal const& _literal)
 
 StringLiteralType const* TypeProvider::stringLiteral(std::string const& literal)
 {
+	std::lock_guard lock(m_mutex);
 	auto i = instance().m_stringLiteralTypes.find(literal);
 	if (i != instance().m_stringLiteralTypes.end())
 		return i->second.get();
@@ -387,6 +399,7 @@ StringLiteralType const* TypeProvider::stringLiteral(std::string const& literal)
 
 FixedPointType const* TypeProvider::fixedPoint(unsigned m, unsigned n, FixedPointType::Modifier _modifier)
 {
+	std::lock_guard lock(m_mutex);
 	auto& map = _modifier == FixedPointType::Modifier::Unsigned ? instance().m_ufixedMxN : instance().m_fixedMxN;
 
 	auto i = map.find(std::make_pair(m, n));
@@ -412,8 +425,11 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	auto type = _type->copyForLocation(_location, _isPointer);
+	ReferenceType const* result = type.get();
+	std::lock_guard lock(m_mutex);
+	instance().m_generalTypes.emplace_back(std::move(type));
+	return result;
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
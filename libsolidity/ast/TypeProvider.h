@@ -23,6 +23,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 
@@ -37,6 +38,8 @@ namespace solidity::frontend
  *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
+ *
+ * Types can be requested from several threads concurrently, apart from @a reset.
  */
 class TypeProvider
 {
@@ -210,6 +213,9 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// Guards the lazily created types and the containers below.
+	static std::mutex m_mutex;
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
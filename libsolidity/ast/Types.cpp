@@ -135,6 +135,8 @@ MemberList::Member::Member(Declaration const* _declaration, Type const* _type, s
 void Type::clearCache() const
 {
 	m_members.clear();
+	m_stackItemsInitialized = false;
+	m_stackSizeInitialized = false;
 	m_stackItems.reset();
 	m_stackSize.reset();
 }
@@ -297,6 +299,7 @@ Type const* Type::commonType(Type const* _a, Type const* _b)
 
 MemberList const& Type::members(ASTNode const* _currentScope) const
 {
+	std::lock_guard lock(util::lazyInitMutex());
 	if (!m_members[_currentScope])
 	{
 		solAssert(
@@ -1978,6 +1981,7 @@ Type const* ArrayType::decodingType() const
 
 TypeResult ArrayType::interfaceType(bool _inLibrary) const
 {
+	std::lock_guard lock(util::lazyInitMutex());
 	if (_inLibrary && m_interfaceType_library.has_value())
 		return *m_interfaceType_library;
 
@@ -2145,6 +2149,7 @@ MemberList::MemberMap ContractType::nativeMembers(ASTNode const*) const
 
 FunctionType const* ContractType::newExpressionType() const
 {
+	std::lock_guard lock(util::lazyInitMutex());
 	if (!m_constructorType)
 		m_constructorType = FunctionType::newExpressionType(m_contract);
 	return m_constructorType;
@@ -2386,6 +2391,7 @@ MemberList::MemberMap StructType::nativeMembers(ASTNode const*) const
 
 TypeResult StructType::interfaceType(bool _inLibrary) const
 {
+	std::lock_guard lock(util::lazyInitMutex());
 	if (!_inLibrary)
 	{
 		if (!m_interfaceType.has_value())
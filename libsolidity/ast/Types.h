@@ -36,6 +36,7 @@
 
 #include <boost/rational.hpp>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <optional>
@@ -314,23 +315,35 @@ public:
 	/// - Each named stack item is typed and contributes the stack slots given by the stack items of its type.
 	std::vector<std::tuple<std::string, Type const*>> const& stackItems() const
 	{
-		if (!m_stackItems)
-			m_stackItems = makeStackItems();
+		if (!m_stackItemsInitialized.load(std::memory_order_acquire))
+		{
+			std::lock_guard lock(util::lazyInitMutex());
+			if (!m_stackItems)
+			{
+				m_stackItems = makeStackItems();
+				m_stackItemsInitialized.store(true, std::memory_order_release);
+			}
+		}
 		return *m_stackItems;
 	}
 	/// Total number of stack slots occupied by this type. This is the sum of ``sizeOnStack`` of all ``stackItems()``.
 	// TODO: consider changing the return type to be size_t
 	unsigned sizeOnStack() const
 	{
-		if (!m_stackSize)
+		if (!m_stackSizeInitialized.load(std::memory_order_acquire))
 		{
-			size_t sizeOnStack = 0;
-			for (auto const& slot: stackItems())
-				if (std::get<1>(slot))
-					sizeOnStack += std::get<1>(slot)->sizeOnStack();
-				else
-					++sizeOnStack;
-			m_stackSize = sizeOnStack;
+			std::lock_guard lock(util::lazyInitMutex());
+			if (!m_stackSize)
+			{
+				size_t sizeOnStack = 0;
+				for (auto const& slot: stackItems())
+					if (std::get<1>(slot))
+						sizeOnStack += std::get<1>(slot)->sizeOnStack();
+					else
+						++sizeOnStack;
+				m_stackSize = sizeOnStack;
+				m_stackSizeInitialized.store(true, std::memory_order_release);
+			}
 		}
 		return static_cast<unsigned>(*m_stackSize);
 	}
@@ -432,9 +445,14 @@ protected:
 
 
 	/// List of member types (parameterised by scape), will be lazy-initialized.
+	/// The lazily initialized members of types are guarded by util::lazyInitMutex(),
+	/// since types are shared between threads.
 	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
+	/// Set after the corresponding cache has been filled, allows reading it without taking the lock.
+	mutable std::atomic<bool> m_stackItemsInitialized = false;
+	mutable std::atomic<bool> m_stackSizeInitialized = false;
 };
 
 /**
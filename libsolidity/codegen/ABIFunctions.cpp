@@ -1191,7 +1191,7 @@ std::string ABIFunctions::abiDecodingFunctionArrayAvailableLength(ArrayType cons
 				if gt(srcEnd, end) {
 					<revertInvalidStride>()
 				}
-				for { let src := offset } lt(src, srcEnd) { src := add(src, <stride>) }
+				<?+copy><copy>(dst, offset, sub(srcEnd, offset))<!+copy>for { let src := offset } lt(src, srcEnd) { src := add(src, <stride>) }
 				{
 					<?dynamicBase>
 						let innerOffset := <load>(src)
@@ -1202,7 +1202,7 @@ std::string ABIFunctions::abiDecodingFunctionArrayAvailableLength(ArrayType cons
 					</dynamicBase>
 					mstore(dst, <decodingFun>(elementPos, end))
 					dst := add(dst, 0x20)
-				}
+				}</+copy>
 			}
 		)");
 		templ("functionName", functionName);
@@ -1217,8 +1217,19 @@ std::string ABIFunctions::abiDecodingFunctionArrayAvailableLength(ArrayType cons
 			"revertInvalidStride",
 			revertReasonIfDebugFunction("ABI decoding: invalid calldata array stride")
 		);
-		templ("revertStringOffset", revertReasonIfDebugFunction("ABI decoding: invalid calldata array offset"));
-		templ("decodingFun", abiDecodingFunction(*_type.baseType(), _fromMemory, false));
+		// Elements of value types occupy a full word both in the encoding and in memory.
+		std::string copy = decodingIsCopy(*_type.baseType()) ? bulkCopyOpcode(_fromMemory) : "";
+		templ("copy", copy);
+		if (copy.empty())
+		{
+			templ("revertStringOffset", revertReasonIfDebugFunction("ABI decoding: invalid calldata array offset"));
+			templ("decodingFun", abiDecodingFunction(*_type.baseType(), _fromMemory, false));
+		}
+		else
+		{
+			templ("revertStringOffset", "");
+			templ("decodingFun", "");
+		}
 		return templ.render();
 	});
 }
@@ -1339,12 +1350,12 @@ std::string ABIFunctions::abiDecodingFunctionStruct(StructType const& _type, boo
 			function <functionName>(headStart, end) -> value {
 				if slt(sub(end, headStart), <minimumSize>) { <revertString>() }
 				value := <allocate>(<memorySize>)
-				<#members>
+				<?+copy><copy>(value, headStart, <memorySize>)<!+copy><#members>
 				{
 					// <memberName>
 					<decode>
 				}
-				</members>
+				</members></+copy>
 			}
 		)");
 		// TODO add test
@@ -1354,14 +1365,27 @@ std::string ABIFunctions::abiDecodingFunctionStruct(StructType const& _type, boo
 		templ("allocate", m_utils.allocationFunction());
 		solAssert(_type.memoryDataSize() < u256("0xffffffffffffffff"), "");
 		templ("memorySize", toCompactHexWithPrefix(_type.memoryDataSize()));
+		// Structs consisting only of members that are decoded by copying have the same layout
+		// in the encoding and in memory.
+		auto const& structMembers = _type.members(nullptr);
+		bool const copy = std::all_of(structMembers.begin(), structMembers.end(), [](auto const& _member) {
+			return decodingIsCopy(*_member.type);
+		});
+		templ("copy", copy ? bulkCopyOpcode(_fromMemory) : "");
 		size_t headPos = 0;
 		std::vector<std::map<std::string, std::string>> members;
-		for (auto const& member: _type.members(nullptr))
+		for (auto const& member: structMembers)
 		{
 			solAssert(member.type, "");
 			solAssert(!member.type->containsNestedMapping(), "");
 			auto decodingType = member.type->decodingType();
 			solAssert(decodingType, "");
+			if (copy)
+			{
+				solAssert(_type.memoryOffsetOfMember(member.name) == headPos);
+				headPos += decodingType->calldataHeadSize();
+				continue;
+			}
 			Whiskers memberTempl(R"(
 				<?dynamic>
 					let offset := <load>(add(headStart, <pos>))
@@ -1384,6 +1408,7 @@ std::string ABIFunctions::abiDecodingFunctionStruct(StructType const& _type, boo
 			members.back()["memberName"] = member.name;
 			headPos += decodingType->calldataHeadSize();
 		}
+		solAssert(!copy || _type.memoryDataSize() == headPos);
 		templ("members", members);
 		templ("minimumSize", toCompactHexWithPrefix(headPos));
 		return templ.render();
@@ -1535,7 +1560,27 @@ std::string ABIFunctions::arrayStoreLengthForEncodingFunction(ArrayType const& _
 
 std::string ABIFunctions::createFunction(std::string const& _name, std::function<std::string ()> const& _creator)
 {
-	return m_functionCollector.createFunction(_name, _creator);
+	return m_functionCollector.createSharedFunction(m_utils.sharedFunctionScope(), _name, _creator);
+}
+
+bool ABIFunctions::decodingIsCopy(Type const& _type)
+{
+	Type const* type = &_type;
+	if (auto const* userDefinedValueType = dynamic_cast<UserDefinedValueType const*>(type))
+		type = &userDefinedValueType->underlyingType();
+	// Cleanup and validation are no-ops for types that use the full word.
+	if (auto const* integerType = dynamic_cast<IntegerType const*>(type))
+		return integerType->numBits() == 256;
+	if (auto const* fixedBytesType = dynamic_cast<FixedBytesType const*>(type))
+		return fixedBytesType->numBytes() == 32;
+	return false;
+}
+
+std::string ABIFunctions::bulkCopyOpcode(bool _fromMemory) const
+{
+	if (!_fromMemory)
+		return "calldatacopy";
+	return m_evmVersion.hasMcopy() ? "mcopy" : "";
 }
 
 size_t ABIFunctions::headSize(TypePointers const& _targetTypes)
@@ -262,12 +262,20 @@ private:
 
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
-	/// cases.
+	/// cases. The function is shared with other contracts compiled with the same settings.
 	std::string createFunction(std::string const& _name, std::function<std::string()> const& _creator);
 
 	/// @returns the size of the static part of the encoding of the given types.
 	static size_t headSize(TypePointers const& _targetTypes);
 
+	/// @returns true if values of type @a _type need no validation when decoded and their
+	/// encoding is identical to their representation in memory, so that decoding is a plain copy.
+	static bool decodingIsCopy(Type const& _type);
+
+	/// @returns the name of the opcode that copies decoded data to memory if decoding is a
+	/// plain copy, or an empty string if the copy has to be done word by word.
+	std::string bulkCopyOpcode(bool _fromMemory) const;
+
 	/// @returns the number of variables needed to store a type.
 	/// This is one for almost all types. The exception being dynamically sized calldata arrays or
 	/// external function types (if we are encoding from stack, i.e. _options.encodeFunctionFromStack
@@ -550,6 +550,7 @@ void CompilerContext::optimizeYul(yul::Object& _object, OptimiserSettings const&
 		_optimiserSettings.yulOptimiserSteps,
 		_optimiserSettings.yulOptimiserCleanupSteps,
 		isCreation? std::nullopt : std::make_optional(_optimiserSettings.expectedExecutionsPerDeployment),
+		_optimiserSettings.expectedExecutionsPerDeployment,
 		_externalIdentifiers
 	);
 
@@ -296,6 +296,11 @@ public:
 	/// Appends code that computes the Keccak-256 hash of the topmost stack element of 32 byte type.
 	void computeHashStatic();
 
+	/// @returns true if a function dispatcher should split the @a _functionCount sorted function
+	/// selectors at the median instead of comparing the selector to each of them in turn,
+	/// given the expected number of executions @a _runs.
+	static bool splitFunctionSelectors(size_t _functionCount, size_t _runs);
+
 	/// Appends code that copies the code of the given contract to memory.
 	/// Stack pre: Memory position
 	/// Stack post: Updated memory position
@@ -30,16 +30,38 @@ using namespace solidity;
 using namespace solidity::frontend;
 using namespace solidity::util;
 
+std::shared_ptr<MultiUseYulFunctionCollector::SharedFunctions::Function const>
+MultiUseYulFunctionCollector::SharedFunctions::find(std::string const& _scope, std::string const& _name) const
+{
+	std::lock_guard lock(m_mutex);
+	auto it = m_functions.find({_scope, _name});
+	return it == m_functions.end() ? nullptr : it->second;
+}
+
+void MultiUseYulFunctionCollector::SharedFunctions::insert(
+	std::string const& _scope,
+	std::string const& _name,
+	Function _function
+)
+{
+	auto function = std::make_shared<Function const>(std::move(_function));
+	std::lock_guard lock(m_mutex);
+	m_functions.emplace(std::make_pair(_scope, _name), std::move(function));
+}
+
 std::string MultiUseYulFunctionCollector::requestedFunctions()
 {
 	std::string result = std::move(m_code);
 	m_code.clear();
 	m_requestedFunctions.clear();
+	m_uncacheableFunctions.clear();
 	return result;
 }
 
 std::string MultiUseYulFunctionCollector::createFunction(std::string const& _name, std::function<std::string()> const& _creator)
 {
+	// The shared functions cannot replay requests of functions that are not shared.
+	markRecordingsUncacheable();
 	if (!m_requestedFunctions.count(_name))
 	{
 		m_requestedFunctions.insert(_name);
@@ -57,24 +79,125 @@ std::string MultiUseYulFunctionCollector::createFunction(
 )
 {
 	solAssert(!_name.empty(), "");
+	markRecordingsUncacheable();
 	if (!m_requestedFunctions.count(_name))
 	{
 		m_requestedFunctions.insert(_name);
-		std::vector<std::string> arguments;
-		std::vector<std::string> returnParameters;
-		std::string body = _creator(arguments, returnParameters);
-		solAssert(!body.empty(), "");
-
-		m_code += Whiskers(R"(
-			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
-				<body>
-			}
-		)")
-		("functionName", _name)
-		("args", joinHumanReadable(arguments))
-		("retParams", joinHumanReadable(returnParameters))
-		("body", body)
-		.render();
+		m_code += renderFunction(_name, _creator);
+	}
+	return _name;
+}
+
+std::string MultiUseYulFunctionCollector::createSharedFunction(
+	std::string const& _scope,
+	std::string const& _name,
+	std::function<std::string()> const& _creator
+)
+{
+	return createSharedFunction(_scope, _name, _creator, true);
+}
+
+std::string MultiUseYulFunctionCollector::createSharedFunction(
+	std::string const& _scope,
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	solAssert(!_name.empty(), "");
+	return createSharedFunction(_scope, _name, [&]() { return renderFunction(_name, _creator); }, false);
+}
+
+std::string MultiUseYulFunctionCollector::renderFunction(
+	std::string const& _name,
+	std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+)
+{
+	std::vector<std::string> arguments;
+	std::vector<std::string> returnParameters;
+	std::string body = _creator(arguments, returnParameters);
+	solAssert(!body.empty(), "");
+
+	return Whiskers(R"(
+		function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
+			<body>
+		}
+	)")
+	("functionName", _name)
+	("args", joinHumanReadable(arguments))
+	("retParams", joinHumanReadable(returnParameters))
+	("body", body)
+	.render();
+}
+
+std::string MultiUseYulFunctionCollector::createSharedFunction(
+	std::string const& _scope,
+	std::string const& _name,
+	std::function<std::string()> const& _generate,
+	bool _validate
+)
+{
+	if (!m_recordings.empty())
+		m_recordings.back().dependencies.emplace_back(_name);
+	if (m_requestedFunctions.count(_name))
+	{
+		if (m_uncacheableFunctions.count(_name))
+			markRecordingsUncacheable();
+		return _name;
+	}
+
+	if (m_sharedFunctions)
+		if (auto function = m_sharedFunctions->find(_scope, _name))
+		{
+			addSharedFunction(_scope, _name, *function);
+			return _name;
+		}
+
+	m_requestedFunctions.insert(_name);
+	m_recordings.emplace_back();
+	std::string fun = _generate();
+	Recording recording = std::move(m_recordings.back());
+	m_recordings.pop_back();
+	if (_validate)
+	{
+		solAssert(!fun.empty(), "");
+		solAssert(fun.find("function " + _name + "(") != std::string::npos, "Function not properly named.");
 	}
+
+	if (m_sharedFunctions)
+	{
+		if (recording.cacheable)
+			m_sharedFunctions->insert(_scope, _name, {fun, std::move(recording.dependencies)});
+		else
+		{
+			m_uncacheableFunctions.insert(_name);
+			markRecordingsUncacheable();
+		}
+	}
+	m_code += std::move(fun);
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::addSharedFunction(
+	std::string const& _scope,
+	std::string const& _name,
+	SharedFunctions::Function const& _function
+)
+{
+	m_requestedFunctions.insert(_name);
+	// Dependencies come first, in the order in which generating the function would have added them.
+	for (std::string const& dependency: _function.dependencies)
+		if (!m_requestedFunctions.count(dependency))
+		{
+			auto sharedDependency = m_sharedFunctions->find(_scope, dependency);
+			// Functions are only shared if all their dependencies are.
+			solAssert(sharedDependency, "");
+			addSharedFunction(_scope, dependency, *sharedDependency);
+		}
+	m_code += _function.code;
+}
+
+void MultiUseYulFunctionCollector::markRecordingsUncacheable()
+{
+	for (Recording& recording: m_recordings)
+		recording.cacheable = false;
+}
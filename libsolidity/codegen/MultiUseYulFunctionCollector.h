@@ -24,8 +24,11 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -37,6 +40,32 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	/**
+	 * Functions generated by the collectors of all contracts of a compilation, so that each of
+	 * them only has to be generated once. Thread-safe.
+	 */
+	class SharedFunctions
+	{
+	public:
+		struct Function
+		{
+			std::string code;
+			/// Names of the functions requested while generating the function, in order.
+			std::vector<std::string> dependencies;
+		};
+
+		std::shared_ptr<Function const> find(std::string const& _scope, std::string const& _name) const;
+		void insert(std::string const& _scope, std::string const& _name, Function _function);
+
+	private:
+		mutable std::mutex m_mutex;
+		std::map<std::pair<std::string, std::string>, std::shared_ptr<Function const>> m_functions;
+	};
+
+	explicit MultiUseYulFunctionCollector(std::shared_ptr<SharedFunctions> _sharedFunctions = nullptr):
+		m_sharedFunctions(std::move(_sharedFunctions))
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -47,6 +76,24 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Same as @a createFunction, but takes the function from the shared functions if it was
+	/// already generated for another contract and stores it there otherwise. Only to be used
+	/// for functions whose code depends on nothing but their name and the settings identified
+	/// by @a _scope.
+	std::string createSharedFunction(
+		std::string const& _scope,
+		std::string const& _name,
+		std::function<std::string()> const& _creator
+	);
+
+	std::string createSharedFunction(
+		std::string const& _scope,
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
+	std::shared_ptr<SharedFunctions> const& sharedFunctions() const { return m_sharedFunctions; }
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -57,6 +104,36 @@ public:
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
 private:
+	/// Functions requested while generating a shared function.
+	struct Recording
+	{
+		std::vector<std::string> dependencies;
+		/// False if the function requested a function that cannot be shared.
+		bool cacheable = true;
+	};
+
+	static std::string renderFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+	/// Shared implementation of both variants of @a createSharedFunction, @a _generate
+	/// returns the complete code of the function.
+	std::string createSharedFunction(
+		std::string const& _scope,
+		std::string const& _name,
+		std::function<std::string()> const& _generate,
+		bool _validate
+	);
+	/// Adds a function taken from the shared functions, together with all its dependencies
+	/// that were not requested yet.
+	void addSharedFunction(std::string const& _scope, std::string const& _name, SharedFunctions::Function const& _function);
+	/// Prevents the functions that are currently being generated from being shared.
+	void markRecordingsUncacheable();
+
+	std::shared_ptr<SharedFunctions> m_sharedFunctions;
+	std::vector<Recording> m_recordings;
+	/// Functions that were generated by this collector but could not be shared.
+	std::set<std::string> m_uncacheableFunctions;
 	std::set<std::string> m_requestedFunctions;
 	std::string m_code;
 };
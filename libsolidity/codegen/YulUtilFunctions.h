@@ -59,9 +59,18 @@ public:
 		m_evmVersion(_evmVersion),
 		m_eofVersion(_eofVersion),
 		m_revertStrings(_revertStrings),
-		m_functionCollector(_functionCollector)
+		m_functionCollector(_functionCollector),
+		m_sharedFunctionScope(
+			_evmVersion.name() + "/" +
+			(_eofVersion.has_value() ? "eof" + std::to_string(*_eofVersion) : "legacy") + "/" +
+			revertStringsToString(_revertStrings)
+		)
 	{}
 
+	/// @returns the identifier of the settings the generated functions depend on. Functions are
+	/// only shared between contracts compiled with the same settings.
+	std::string const& sharedFunctionScope() const { return m_sharedFunctionScope; }
+
 	/// @returns the name of a function that returns its argument.
 	/// Sometimes needed to satisfy templates.
 	std::string identityFunction();
@@ -564,6 +573,14 @@ public:
 	std::string externalFunctionPointersEqualFunction();
 
 private:
+	/// Creates the function via @a m_functionCollector, shared with other contracts
+	/// compiled with the same settings.
+	std::string createFunction(std::string const& _name, std::function<std::string()> const& _creator);
+	std::string createFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	/// @returns the name of a function that copies a struct from calldata or memory to storage
 	/// signature: (slot, value) ->
 	std::string copyStructToStorageFunction(StructType const& _from, StructType const& _to);
@@ -645,6 +662,7 @@ private:
 	std::optional<uint8_t> m_eofVersion;
 	RevertStrings m_revertStrings;
 	MultiUseYulFunctionCollector& m_functionCollector;
+	std::string m_sharedFunctionScope;
 };
 
 }
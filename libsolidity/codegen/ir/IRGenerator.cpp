@@ -30,8 +30,13 @@
 #include <libsolidity/codegen/ABIFunctions.h>
 #include <libsolidity/codegen/CompilerUtils.h>
 
+#include <libyul/AsmParser.h>
+#include <libyul/AST.h>
 #include <libyul/Object.h>
 #include <libyul/Utilities.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <liblangutil/ErrorReporter.h>
 
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/CommonData.h>
@@ -88,19 +93,22 @@ std::set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCalla
 
 }
 
-std::string IRGenerator::run(
+std::pair<std::string, std::shared_ptr<yul::Object>> IRGenerator::run(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+	std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+	std::map<ContractDefinition const*, std::shared_ptr<yul::Object const>> const& _otherYulObjects
 )
 {
-	return yul::reindent(generate(_contract, _cborMetadata, _otherYulSources));
+	auto [ir, object] = generate(_contract, _cborMetadata, _otherYulSources, _otherYulObjects);
+	return {yul::reindent(ir), std::move(object)};
 }
 
-std::string IRGenerator::generate(
+std::pair<std::string, std::shared_ptr<yul::Object>> IRGenerator::generate(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+	std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+	std::map<ContractDefinition const*, std::shared_ptr<yul::Object const>> const& _otherYulObjects
 )
 {
 	auto subObjectSources = [&_otherYulSources](UniqueVector<ContractDefinition const*> const& _subObjects) -> std::string
@@ -110,6 +118,15 @@ std::string IRGenerator::generate(
 			subObjectsSources += _otherYulSources.at(subObject);
 		return subObjectsSources;
 	};
+	auto addSubObjects = [&_otherYulObjects](yul::Object& _container, UniqueVector<ContractDefinition const*> const& _subObjects)
+	{
+		for (ContractDefinition const* subObject: _subObjects)
+		{
+			std::shared_ptr<yul::Object const> const& object = _otherYulObjects.at(subObject);
+			solAssert(object);
+			_container.addSubObject(object->copyTree());
+		}
+	};
 	auto formatUseSrcMap = [](IRGenerationContext const& _context) -> std::string
 	{
 		return joinHumanReadable(
@@ -119,12 +136,40 @@ std::string IRGenerator::generate(
 			", "
 		);
 	};
+	auto sourceNameMap = [](IRGenerationContext const& _context) -> yul::SourceNameMap
+	{
+		yul::SourceNameMap sourceNames;
+		for (std::string const& sourceName: _context.usedSourceNames())
+			sourceNames[_context.sourceIndices().at(sourceName)] = std::make_shared<std::string const>(sourceName);
+		return sourceNames;
+	};
+	auto newObject = [this](std::string _name, std::string const& _code, yul::SourceNameMap _sourceNames) -> std::shared_ptr<yul::Object>
+	{
+		auto object = std::make_shared<yul::Object>();
+		object->name = std::move(_name);
+		object->debugData = std::make_shared<yul::ObjectDebugData>(yul::ObjectDebugData{_sourceNames});
+		object->setCode(parseCode(_code, std::move(_sourceNames)));
+		return object;
+	};
 
 	Whiskers t(R"(<?isEthdebugEnabled>/// ethdebug: enabled</isEthdebugEnabled>
 		/// @use-src <useSrcMapCreation>
 		object "<CreationObject>" {
 			code {
-				<sourceLocationCommentCreation>
+				<creationCode>
+			}
+			/// @use-src <useSrcMapDeployed>
+			object "<DeployedObject>" {
+				code {
+					<deployedCode>
+				}
+				<deployedSubObjects>
+				data "<metadataName>" hex"<cborMetadata>"
+			}
+			<subObjects>
+		}
+	)");
+	Whiskers creationCode(R"(<sourceLocationCommentCreation>
 				<memoryInitCreation>
 				<callValueCheck>
 				<?library>
@@ -133,12 +178,8 @@ std::string IRGenerator::generate(
 				<constructor>(<constructorParams>)
 				</library>
 				<deploy>
-				<functions>
-			}
-			/// @use-src <useSrcMapDeployed>
-			object "<DeployedObject>" {
-				code {
-					<sourceLocationCommentDeployed>
+				<functions>)");
+	Whiskers deployedCode(R"(<sourceLocationCommentDeployed>
 					<memoryInitDeployed>
 					<?library>
 						<?eof>
@@ -148,14 +189,7 @@ std::string IRGenerator::generate(
 						</eof>
 					</library>
 					<dispatch>
-					<deployedFunctions>
-				}
-				<deployedSubObjects>
-				data "<metadataName>" hex"<cborMetadata>"
-			}
-			<subObjects>
-		}
-	)");
+					<deployedFunctions>)");
 
 	resetContext(_contract, ExecutionContext::Creation);
 	auto const eof = m_context.eofVersion().has_value();
@@ -166,17 +200,17 @@ std::string IRGenerator::generate(
 
 	t("isEthdebugEnabled", m_context.debugInfoSelection().ethdebug);
 	t("CreationObject", IRNames::creationObject(_contract));
-	t("sourceLocationCommentCreation", dispenseLocationComment(_contract));
-	t("library", _contract.isLibrary());
+	creationCode("sourceLocationCommentCreation", dispenseLocationComment(_contract));
+	creationCode("library", _contract.isLibrary());
 
 	FunctionDefinition const* constructor = _contract.constructor();
-	t("callValueCheck", !constructor || !constructor->isPayable() ? callValueCheck() : "");
+	creationCode("callValueCheck", !constructor || !constructor->isPayable() ? callValueCheck() : "");
 	std::vector<std::string> constructorParams;
 	if (constructor && !constructor->parameters().empty())
 	{
 		for (size_t i = 0; i < CompilerUtils::sizeOnStack(constructor->parameters()); ++i)
 			constructorParams.emplace_back(m_context.newYulVariable());
-		t(
+		creationCode(
 			"copyConstructorArguments",
 			m_utils.copyConstructorArgumentsToMemoryFunction(
 				_contract,
@@ -184,22 +218,30 @@ std::string IRGenerator::generate(
 			)
 		);
 	}
-	t("constructorParams", joinHumanReadable(constructorParams));
-	t("constructorHasParams", !constructorParams.empty());
-	t("constructor", IRNames::constructor(_contract));
+	creationCode("constructorParams", joinHumanReadable(constructorParams));
+	creationCode("constructorHasParams", !constructorParams.empty());
+	creationCode("constructor", IRNames::constructor(_contract));
 
-	t("deploy", deployCode(_contract));
+	creationCode("deploy", deployCode(_contract));
 	generateConstructors(_contract);
 	std::set<FunctionDefinition const*> creationFunctionList = generateQueuedFunctions();
 	InternalDispatchMap internalDispatchMap = generateInternalDispatchFunctions(_contract);
 
-	t("functions", m_context.functionCollector().requestedFunctions());
+	creationCode("functions", m_context.functionCollector().requestedFunctions());
 	t("subObjects", subObjectSources(m_context.subObjectsCreated()));
+	UniqueVector<ContractDefinition const*> const creationSubObjects = m_context.subObjectsCreated();
 
 	// This has to be called only after all other code generation for the creation object is complete.
 	bool creationInvolvesMemoryUnsafeAssembly = m_context.memoryUnsafeInlineAssemblySeen();
-	t("memoryInitCreation", memoryInit(!creationInvolvesMemoryUnsafeAssembly));
+	creationCode("memoryInitCreation", memoryInit(!creationInvolvesMemoryUnsafeAssembly));
 	t("useSrcMapCreation", formatUseSrcMap(m_context));
+	std::string const creationCodeSource = creationCode.render();
+	t("creationCode", creationCodeSource);
+	std::shared_ptr<yul::Object> creationObject = newObject(
+		IRNames::creationObject(_contract),
+		creationCodeSource,
+		sourceNameMap(m_context)
+	);
 
 	auto const immutableVariables = m_context.immutableVariables();
 	auto const libraryAddressImmutableOffset = (_contract.isLibrary() && eof) ?
@@ -223,36 +265,64 @@ std::string IRGenerator::generate(
 
 	// Do not register immutables to avoid assignment.
 	t("DeployedObject", IRNames::deployedObject(_contract));
-	t("sourceLocationCommentDeployed", dispenseLocationComment(_contract));
-	t("eof", eof);
+	deployedCode("sourceLocationCommentDeployed", dispenseLocationComment(_contract));
+	deployedCode("library", _contract.isLibrary());
+	deployedCode("eof", eof);
 	if (_contract.isLibrary())
 	{
 		if (!eof)
-			t("library_address", IRNames::libraryAddressImmutable());
+			deployedCode("library_address", IRNames::libraryAddressImmutable());
 		else
-			t("library_address_immutable_offset", std::to_string(m_context.libraryAddressImmutableOffsetRelative()));
+			deployedCode("library_address_immutable_offset", std::to_string(m_context.libraryAddressImmutableOffsetRelative()));
 	}
 
-	t("dispatch", dispatchRoutine(_contract));
+	deployedCode("dispatch", dispatchRoutine(_contract));
 	std::set<FunctionDefinition const*> deployedFunctionList = generateQueuedFunctions();
 	generateInternalDispatchFunctions(_contract);
-	t("deployedFunctions", m_context.functionCollector().requestedFunctions());
+	deployedCode("deployedFunctions", m_context.functionCollector().requestedFunctions());
 	t("deployedSubObjects", subObjectSources(m_context.subObjectsCreated()));
 	t("metadataName", yul::Object::metadataName());
 	t("cborMetadata", util::toHex(_cborMetadata));
 
 	t("useSrcMapDeployed", formatUseSrcMap(m_context));
+	yul::SourceNameMap deployedSourceNames = sourceNameMap(m_context);
 
 	// This has to be called only after all other code generation for the deployed object is complete.
 	bool deployedInvolvesMemoryUnsafeAssembly = m_context.memoryUnsafeInlineAssemblySeen();
-	t("memoryInitDeployed", memoryInit(!deployedInvolvesMemoryUnsafeAssembly));
+	deployedCode("memoryInitDeployed", memoryInit(!deployedInvolvesMemoryUnsafeAssembly));
+	std::string const deployedCodeSource = deployedCode.render();
+	t("deployedCode", deployedCodeSource);
+
+	std::shared_ptr<yul::Object> deployedObject = newObject(
+		IRNames::deployedObject(_contract),
+		deployedCodeSource,
+		std::move(deployedSourceNames)
+	);
+	addSubObjects(*deployedObject, m_context.subObjectsCreated());
+	deployedObject->addSubObject(std::make_shared<yul::Data>(yul::Object::metadataName(), _cborMetadata));
+	creationObject->addSubObject(std::move(deployedObject));
+	addSubObjects(*creationObject, creationSubObjects);
 
 	solAssert(_contract.annotation().creationCallGraph->get() != nullptr, "");
 	solAssert(_contract.annotation().deployedCallGraph->get() != nullptr, "");
 	verifyCallGraph(collectReachableCallables(**_contract.annotation().creationCallGraph), std::move(creationFunctionList));
 	verifyCallGraph(collectReachableCallables(**_contract.annotation().deployedCallGraph), std::move(deployedFunctionList));
 
-	return t.render();
+	return {t.render(), std::move(creationObject)};
+}
+
+std::shared_ptr<yul::AST> IRGenerator::parseCode(std::string const& _code, yul::SourceNameMap _sourceNames) const
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	CharStream charStream("{\n" + _code + "\n}", "");
+	std::shared_ptr<yul::AST> ast = yul::Parser(
+		errorReporter,
+		yul::EVMDialect::strictAssemblyForEVMObjects(m_evmVersion, m_eofVersion),
+		std::move(_sourceNames)
+	).parse(charStream);
+	solAssert(ast && !errorReporter.hasErrors(), "Invalid IR generated:\n" + _code);
+	return ast;
 }
 
 std::string IRGenerator::generate(Block const& _block)
@@ -1051,32 +1121,19 @@ std::string IRGenerator::callValueCheck()
 std::string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 {
 	Whiskers t(R"X(
-		<?+cases>if iszero(lt(calldatasize(), 4))
+		<?+dispatch>if iszero(lt(calldatasize(), 4))
 		{
 			let selector := <shr224>(calldataload(0))
-			switch selector
-			<#cases>
-			case <functionSelector>
-			{
-				// <functionName>
-				<delegatecallCheck>
-				<externalFunction>()
-			}
-			</cases>
-			default {}
-		}</+cases>
+			<dispatch>
+		}</+dispatch>
 		<?+receiveEther>if iszero(calldatasize()) { <receiveEther> }</+receiveEther>
 		<fallback>
 	)X");
 	t("shr224", m_utils.shiftRightFunction(224));
-	std::vector<std::map<std::string, std::string>> functions;
+	std::map<FixedHash<4>, std::string> cases;
 	for (auto const& function: _contract.interfaceFunctions())
 	{
-		functions.emplace_back();
-		std::map<std::string, std::string>& templ = functions.back();
-		templ["functionSelector"] = "0x" + function.first.hex();
 		FunctionTypePointer const& type = function.second;
-		templ["functionName"] = type->externalSignature();
 		std::string delegatecallCheck;
 		if (_contract.isLibrary())
 		{
@@ -1089,11 +1146,62 @@ std::string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 					m_utils.revertReasonIfDebugFunction("Non-view function of library called without DELEGATECALL") +
 					"() }";
 		}
-		templ["delegatecallCheck"] = delegatecallCheck;
 
-		templ["externalFunction"] = generateExternalFunction(_contract, *type);
+		cases[function.first] =
+			"// " + type->externalSignature() + "\n" +
+			delegatecallCheck + "\n" +
+			generateExternalFunction(_contract, *type) + "()";
+	}
+
+	// Selectors named in the hint are checked first and in the given order,
+	// all the others are looked up in ascending order.
+	std::vector<uint32_t> selectorOrder = m_optimiserSettings.dispatcherSelectorOrder;
+	if (selectorOrder.empty() && !m_optimiserSettings.executionProfile.empty())
+	{
+		std::set<uint32_t> selectors;
+		for (auto const& selector: cases | ranges::views::keys)
+			selectors.insert(static_cast<uint32_t>(FixedHash<4>::Arith(selector)));
+		selectorOrder = m_optimiserSettings.executionProfile.dispatchOrder(selectors);
+	}
+	std::vector<FixedHash<4>> hotSelectors;
+	for (uint32_t selector: selectorOrder)
+	{
+		FixedHash<4> hash{FixedHash<4>::Arith(selector)};
+		if (cases.count(hash) && !util::contains(hotSelectors, hash))
+			hotSelectors.emplace_back(hash);
+	}
+	std::vector<FixedHash<4>> otherSelectors;
+	for (auto const& selector: cases | ranges::views::keys)
+		if (!util::contains(hotSelectors, selector))
+			otherSelectors.emplace_back(selector);
+
+	std::string dispatch;
+	if (hotSelectors.empty())
+		dispatch = dispatchSelector(cases, otherSelectors);
+	else
+	{
+		std::vector<std::map<std::string, std::string>> hotCases;
+		for (auto const& selector: hotSelectors)
+			hotCases.emplace_back(std::map<std::string, std::string>{
+				{"functionSelector", "0x" + selector.hex()},
+				{"body", cases.at(selector)}
+			});
+		dispatch = Whiskers(R"(switch selector
+			<#cases>
+			case <functionSelector>
+			{
+				<body>
+			}
+			</cases>
+			default
+			{
+				<others>
+			})")
+		("cases", std::move(hotCases))
+		("others", dispatchSelector(cases, otherSelectors))
+		.render();
 	}
-	t("cases", functions);
+	t("dispatch", dispatch);
 	FunctionDefinition const* etherReceiver = _contract.receiveFunction();
 	if (etherReceiver)
 	{
@@ -1129,6 +1237,50 @@ std::string IRGenerator::dispatchRoutine(ContractDefinition const& _contract)
 	return t.render();
 }
 
+std::string IRGenerator::dispatchSelector(
+	std::map<FixedHash<4>, std::string> const& _cases,
+	std::vector<FixedHash<4>> const& _selectors
+)
+{
+	if (_selectors.empty())
+		return {};
+
+	if (CompilerUtils::splitFunctionSelectors(_selectors.size(), m_optimiserSettings.expectedExecutionsPerDeployment))
+	{
+		auto const pivot = _selectors.begin() + static_cast<ptrdiff_t>(_selectors.size() / 2);
+		return Whiskers(R"(switch lt(selector, <pivot>)
+			case 0
+			{
+				<larger>
+			}
+			default
+			{
+				<smaller>
+			})")
+		("pivot", "0x" + pivot->hex())
+		("larger", dispatchSelector(_cases, {pivot, _selectors.end()}))
+		("smaller", dispatchSelector(_cases, {_selectors.begin(), pivot}))
+		.render();
+	}
+
+	std::vector<std::map<std::string, std::string>> cases;
+	for (auto const& selector: _selectors)
+		cases.emplace_back(std::map<std::string, std::string>{
+			{"functionSelector", "0x" + selector.hex()},
+			{"body", _cases.at(selector)}
+		});
+	return Whiskers(R"(switch selector
+		<#cases>
+		case <functionSelector>
+		{
+			<body>
+		}
+		</cases>
+		default {})")
+	("cases", std::move(cases))
+	.render();
+}
+
 std::string IRGenerator::memoryInit(bool _useMemoryGuard)
 {
 	// This function should be called at the beginning of the EVM call frame
@@ -1168,7 +1320,8 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_context.revertStrings(),
 		m_context.sourceIndices(),
 		m_context.debugInfoSelection(),
-		m_context.soliditySourceProvider()
+		m_context.soliditySourceProvider(),
+		m_context.functionCollector().sharedFunctions()
 	);
 
 	m_context = std::move(newContext);
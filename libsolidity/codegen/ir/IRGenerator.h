@@ -31,9 +31,13 @@
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 
+#include <libyul/Object.h>
+
 #include <liblangutil/CharStreamProvider.h>
 #include <liblangutil/EVMVersion.h>
+#include <libsolutil/FixedHash.h>
 
+#include <memory>
 #include <string>
 
 namespace solidity::frontend
@@ -53,7 +57,8 @@ public:
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
 		langutil::CharStreamProvider const* _soliditySourceProvider,
-		OptimiserSettings& _optimiserSettings
+		OptimiserSettings& _optimiserSettings,
+		std::shared_ptr<MultiUseYulFunctionCollector::SharedFunctions> _sharedFunctions = nullptr
 	):
 		m_evmVersion(_evmVersion),
 		m_eofVersion(_eofVersion),
@@ -64,26 +69,33 @@ public:
 			_revertStrings,
 			std::move(_sourceIndices),
 			_debugInfoSelection,
-			_soliditySourceProvider
+			_soliditySourceProvider,
+			std::move(_sharedFunctions)
 		),
 		m_utils(_evmVersion, _eofVersion, m_context.revertStrings(), m_context.functionCollector()),
 		m_optimiserSettings(_optimiserSettings)
 	{}
 
-	/// Generates and returns (unoptimized) IR code.
-	std::string run(
+	/// Generates (unoptimized) IR code. Returns it as text and as an object tree that does not
+	/// have to be parsed from the text: Only the code blocks of the contract itself are parsed,
+	/// the objects of the contracts it creates are copied from @a _otherYulObjects.
+	std::pair<std::string, std::shared_ptr<yul::Object>> run(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+		std::map<ContractDefinition const*, std::shared_ptr<yul::Object const>> const& _otherYulObjects
 	);
 
 private:
-	std::string generate(
+	std::pair<std::string, std::shared_ptr<yul::Object>> generate(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources,
+		std::map<ContractDefinition const*, std::shared_ptr<yul::Object const>> const& _otherYulObjects
 	);
 	std::string generate(Block const& _block);
+	/// Parses a code block of an object, given without the enclosing braces.
+	std::shared_ptr<yul::AST> parseCode(std::string const& _code, yul::SourceNameMap _sourceNames) const;
 
 	/// Generates code for all the functions from the function generation queue.
 	/// The resulting code is stored in the function collector in IRGenerationContext.
@@ -131,6 +143,14 @@ private:
 	std::string callValueCheck();
 
 	std::string dispatchRoutine(ContractDefinition const& _contract);
+	/// Generates code that executes the case of @a _cases matching the variable `selector`
+	/// if it is one of @a _selectors, which have to be sorted. Does nothing if none matches.
+	/// Depending on the number of selectors and the expected number of executions, this is
+	/// a linear switch or a binary search that ends in linear switches.
+	std::string dispatchSelector(
+		std::map<util::FixedHash<4>, std::string> const& _cases,
+		std::vector<util::FixedHash<4>> const& _selectors
+	);
 
 	/// @a _useMemoryGuard If true, use a memory guard, allowing the optimiser
 	/// to perform memory optimizations.
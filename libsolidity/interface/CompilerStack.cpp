@@ -47,6 +47,7 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/ast/ASTJsonImporter.h>
+#include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/codegen/Compiler.h>
 #include <libsolidity/formal/ModelChecker.h>
 #include <libsolidity/interface/ABI.h>
@@ -94,10 +95,12 @@
 
 #include <fmt/format.h>
 
+#include <atomic>
 #include <utility>
 #include <map>
 #include <limits>
 #include <string>
+#include <thread>
 
 using namespace solidity;
 using namespace solidity::langutil;
@@ -113,6 +116,7 @@ static int g_compilerStackCounts = 0;
 CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
 	m_readFile{std::move(_readFile)},
 	m_objectOptimizer(std::make_shared<yul::ObjectOptimizer>()),
+	m_sharedYulFunctions(std::make_shared<MultiUseYulFunctionCollector::SharedFunctions>()),
 	m_errorReporter{m_errorList}
 {
 	// Because TypeProvider is currently a singleton API, we must ensure that
@@ -245,6 +249,13 @@ void CompilerStack::setEOFVersion(std::optional<uint8_t> _version)
 	m_eofVersion = _version;
 }
 
+void CompilerStack::setAnalysisThreads(size_t _threads)
+{
+	solAssert(m_stackState < AnalysisSuccessful, "Must set the number of analysis threads before analysis.");
+	solAssert(_threads > 0);
+	m_analysisThreads = _threads;
+}
+
 void CompilerStack::setModelCheckerSettings(ModelCheckerSettings _settings)
 {
 	solAssert(m_stackState < ParsedAndImported, "Must set model checking settings before parsing.");
@@ -322,6 +333,7 @@ void CompilerStack::reset(bool _keepSettings)
 		m_evmVersion = langutil::EVMVersion();
 		m_eofVersion.reset();
 		m_modelCheckerSettings = ModelCheckerSettings{};
+		m_analysisThreads = 1;
 		m_selectedContracts.clear();
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
@@ -335,6 +347,8 @@ void CompilerStack::reset(bool _keepSettings)
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	// Names of the generated functions refer to AST IDs, which are only unique within one compilation.
+	m_sharedYulFunctions = std::make_shared<MultiUseYulFunctionCollector::SharedFunctions>();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -426,11 +440,15 @@ bool CompilerStack::parse()
 	return true;
 }
 
-void CompilerStack::importASTs(std::map<std::string, Json> const& _sources)
+void CompilerStack::importASTs(std::map<std::string, Json> _sources)
 {
 	solAssert(m_stackState == Empty, "Must call importASTs only before the SourcesSet state.");
+	// Printed before the import because the importer releases the JSON of the converted sources.
+	std::map<std::string, std::string> printedSources;
+	for (auto const& [path, json]: _sources)
+		printedSources[path] = util::jsonCompactPrint(json);
 	std::map<std::string, ASTPointer<SourceUnit>> reconstructedSources =
-		ASTJsonImporter(m_evmVersion, m_eofVersion).jsonToSourceUnit(_sources);
+		ASTJsonImporter(m_evmVersion, m_eofVersion).jsonToSourceUnit(std::move(_sources));
 	for (auto& src: reconstructedSources)
 	{
 		solUnimplementedAssert(!src.second->experimentalSolidity());
@@ -438,7 +456,7 @@ void CompilerStack::importASTs(std::map<std::string, Json> const& _sources)
 		Source source;
 		source.ast = src.second;
 		source.charStream = std::make_shared<CharStream>(
-			util::jsonCompactPrint(_sources.at(src.first)),
+			std::move(printedSources.at(src.first)),
 			src.first,
 			true // imported from AST
 		);
@@ -564,10 +582,10 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	//
 	// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 	// which is only done one step later.
-	TypeChecker typeChecker(m_evmVersion, m_eofVersion, m_errorReporter);
-	for (Source const* source: m_sourceOrder)
-		if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
-			noErrors = false;
+	if (!analyzeEachSource([&](SourceUnit const& _source, ErrorReporter& _errorReporter) {
+		return TypeChecker(m_evmVersion, m_eofVersion, _errorReporter).checkTypeRequirements(_source);
+	}))
+		noErrors = false;
 
 	if (noErrors)
 	{
@@ -634,10 +652,10 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Checks for common mistakes. Only generates warnings.
-		StaticAnalyzer staticAnalyzer(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !staticAnalyzer.analyze(*source->ast))
-				noErrors = false;
+		if (!analyzeEachSource([](SourceUnit const& _source, ErrorReporter& _errorReporter) {
+			return StaticAnalyzer(_errorReporter).analyze(_source);
+		}))
+			noErrors = false;
 	}
 
 	if (noErrors)
@@ -676,6 +694,128 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	return noErrors;
 }
 
+namespace
+{
+
+/// Calls @a _task for every index below @a _count on up to @a _threads threads.
+/// @returns the exception thrown by the task of each index, if any.
+std::vector<std::exception_ptr> runInParallel(size_t _threads, size_t _count, std::function<void(size_t)> const& _task)
+{
+	std::vector<std::exception_ptr> exceptions(_count);
+	std::atomic<size_t> nextIndex = 0;
+	auto runTasks = [&]() {
+		for (size_t index = nextIndex++; index < _count; index = nextIndex++)
+		{
+			try
+			{
+				_task(index);
+			}
+			catch (...)
+			{
+				exceptions[index] = std::current_exception();
+			}
+		}
+	};
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < std::min(_threads, _count); ++i)
+		threads.emplace_back(runTasks);
+	runTasks();
+	for (std::thread& thread: threads)
+		thread.join();
+	return exceptions;
+}
+
+/// Creates the annotations of all nodes, which are otherwise created on first access.
+class AnnotationCreator: public ASTConstVisitor
+{
+private:
+	bool visitNode(ASTNode const& _node) override
+	{
+		_node.annotation();
+		return true;
+	}
+};
+
+}
+
+bool CompilerStack::analyzeEachSource(std::function<bool(SourceUnit const&, ErrorReporter&)> const& _analysis)
+{
+	std::vector<SourceUnit const*> sourceUnits;
+	for (Source const* source: m_sourceOrder)
+		if (source->ast)
+			sourceUnits.emplace_back(source->ast.get());
+
+	if (m_analysisThreads == 1 || sourceUnits.size() <= 1 || m_errorReporter.hasErrors())
+	{
+		bool success = true;
+		for (SourceUnit const* sourceUnit: sourceUnits)
+			if (!_analysis(*sourceUnit, m_errorReporter))
+				success = false;
+		return success;
+	}
+
+	// Analysing a source reads annotations of the sources it imports, for example the types of
+	// constants used in inline assembly. A source is therefore only analysed after all sources
+	// it is connected to by an import and that come earlier in the source order. Sources in the
+	// same level do not import each other and can be analysed concurrently.
+	std::vector<std::set<SourceUnit const*>> imports;
+	for (SourceUnit const* sourceUnit: sourceUnits)
+		imports.emplace_back(sourceUnit->referencedSourceUnits());
+	std::vector<std::vector<size_t>> levels;
+	std::vector<size_t> levelOfSource(sourceUnits.size(), 0);
+	for (size_t index = 0; index < sourceUnits.size(); ++index)
+	{
+		for (size_t earlier = 0; earlier < index; ++earlier)
+			if (imports[index].count(sourceUnits[earlier]) || imports[earlier].count(sourceUnits[index]))
+				levelOfSource[index] = std::max(levelOfSource[index], levelOfSource[earlier] + 1);
+		if (levelOfSource[index] == levels.size())
+			levels.emplace_back();
+		levels[levelOfSource[index]].emplace_back(index);
+	}
+
+	// Annotations of nodes in other sources are accessed concurrently.
+	AnnotationCreator annotationCreator;
+	for (SourceUnit const* sourceUnit: sourceUnits)
+		sourceUnit->accept(annotationCreator);
+
+	struct Result
+	{
+		ErrorList errors;
+		bool success = true;
+	};
+	bool success = true;
+	for (std::vector<size_t> const& level: levels)
+	{
+		// Some checks assert that an error was reported for an invalid construct in an imported
+		// source, which is only visible to the reporter the error was reported to. Once there
+		// are errors, the remaining sources are analysed one after the other.
+		if (level.size() <= 1 || m_errorReporter.hasErrors())
+		{
+			for (size_t index: level)
+				if (!_analysis(*sourceUnits[index], m_errorReporter))
+					success = false;
+			continue;
+		}
+
+		std::vector<Result> results(level.size());
+		std::vector<std::exception_ptr> exceptions = runInParallel(m_analysisThreads, level.size(), [&](size_t _index) {
+			ErrorReporter errorReporter(results[_index].errors);
+			results[_index].success = _analysis(*sourceUnits[level[_index]], errorReporter);
+		});
+
+		// Report everything as if the sources of the level had been analysed one after the other.
+		for (size_t index = 0; index < results.size(); ++index)
+		{
+			m_errorReporter.report(results[index].errors);
+			if (exceptions[index])
+				std::rethrow_exception(exceptions[index]);
+			if (!results[index].success)
+				success = false;
+		}
+	}
+	return success;
+}
+
 bool CompilerStack::analyzeExperimental()
 {
 	solAssert(!m_experimentalAnalysis);
@@ -731,6 +871,7 @@ CompilerStack::PipelineConfig CompilerStack::requestedPipelineConfig(ContractDef
 		false, // irCodegen
 		false, // irOptimization
 		true,  // bytecode
+		true,  // debugData
 	};
 
 	// If nothing was explicitly selected, all contracts are selected by default.
@@ -782,6 +923,10 @@ bool CompilerStack::compile(State _stopAfter)
 								compileContract(*contract, otherCompilers);
 							}
 						}
+						// The optimized IR is only printed if it is requested. Otherwise it is not
+						// needed after the code generation and can be released.
+						if (!pipelineConfig.irOptimization)
+							m_contracts.at(contract->fullyQualifiedName()).yulIROptimizedStack.reset();
 					}
 					catch (Error const& _error)
 					{
@@ -796,6 +941,10 @@ bool CompilerStack::compile(State _stopAfter)
 						return false;
 				}
 
+	// The object trees of the unoptimized IR are only needed to generate the IR of other contracts.
+	for (auto& contract: m_contracts)
+		contract.second.yulIRObject.reset();
+
 	solAssert(!m_errorReporter.hasErrors());
 	m_stackState = CompilationSuccessful;
 	this->link();
@@ -812,9 +961,14 @@ void CompilerStack::link()
 	}
 }
 
-YulStack CompilerStack::loadGeneratedIR(std::string const& _ir) const
+std::unique_ptr<YulStack> CompilerStack::loadGeneratedIR(std::string const& _ir) const
 {
-	YulStack stack(
+	return loadGeneratedIR(_ir, nullptr);
+}
+
+std::unique_ptr<YulStack> CompilerStack::loadGeneratedIR(std::string const& _ir, std::shared_ptr<yul::Object> _object) const
+{
+	auto stack = std::make_unique<YulStack>(
 		m_evmVersion,
 		m_eofVersion,
 		YulStack::Language::StrictAssembly,
@@ -823,14 +977,16 @@ YulStack CompilerStack::loadGeneratedIR(std::string const& _ir) const
 		this, // _soliditySourceProvider
 		m_objectOptimizer
 	);
-	bool yulAnalysisSuccessful = stack.parseAndAnalyze("", _ir);
+	bool yulAnalysisSuccessful = _object ?
+		stack->analyze("", _ir, std::move(_object)) :
+		stack->parseAndAnalyze("", _ir);
 	solAssert(
 		yulAnalysisSuccessful,
 		_ir + "\n\n"
 		"Invalid IR generated:\n" +
 		SourceReferenceFormatter::formatErrorInformation(
-			stack.errors(),
-			stack, // _charStreamProvider
+			stack->errors(),
+			*stack, // _charStreamProvider
 			false, // _colored
 			true   // _withErrorIds
 		) + "\n"
@@ -998,7 +1154,7 @@ std::optional<Json> CompilerStack::yulIRAst(std::string const& _contractName) co
 	yulAssert(currentContract.yulIR.has_value() == currentContract.contract->canBeDeployed());
 	if (!currentContract.yulIR)
 		return std::nullopt;
-	return loadGeneratedIR(*currentContract.yulIR).astJson();
+	return loadGeneratedIR(*currentContract.yulIR)->astJson();
 }
 
 std::optional<Json> CompilerStack::yulCFGJson(std::string const& _contractName) const
@@ -1010,16 +1166,23 @@ std::optional<Json> CompilerStack::yulCFGJson(std::string const& _contractName)
 	// keep it around when compiling a large project containing many contracts.
 	Contract const& currentContract = contract(_contractName);
 	yulAssert(currentContract.contract);
-	yulAssert(currentContract.yulIROptimized.has_value() == currentContract.contract->canBeDeployed());
-	if (!currentContract.yulIROptimized)
+	std::optional<std::string> const& optimizedIR = yulIROptimized(_contractName);
+	yulAssert(optimizedIR.has_value() == currentContract.contract->canBeDeployed());
+	if (!optimizedIR)
 		return std::nullopt;
-	return loadGeneratedIR(*currentContract.yulIROptimized).cfgJson();
+	return loadGeneratedIR(*optimizedIR)->cfgJson();
 }
 
 std::optional<std::string> const& CompilerStack::yulIROptimized(std::string const& _contractName) const
 {
 	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
-	return contract(_contractName).yulIROptimized;
+	Contract const& currentContract = contract(_contractName);
+	if (!currentContract.yulIROptimized && currentContract.yulIROptimizedStack)
+	{
+		currentContract.yulIROptimized = currentContract.yulIROptimizedStack->print();
+		currentContract.yulIROptimizedStack.reset();
+	}
+	return currentContract.yulIROptimized;
 }
 
 std::optional<Json> CompilerStack::yulIROptimizedAst(std::string const& _contractName) const
@@ -1031,10 +1194,11 @@ std::optional<Json> CompilerStack::yulIROptimizedAst(std::string const& _contrac
 	// keep it around when compiling a large project containing many contracts.
 	Contract const& currentContract = contract(_contractName);
 	yulAssert(currentContract.contract);
-	yulAssert(currentContract.yulIROptimized.has_value() == currentContract.contract->canBeDeployed());
-	if (!currentContract.yulIROptimized)
+	std::optional<std::string> const& optimizedIR = yulIROptimized(_contractName);
+	yulAssert(optimizedIR.has_value() == currentContract.contract->canBeDeployed());
+	if (!optimizedIR)
 		return std::nullopt;
-	return loadGeneratedIR(*currentContract.yulIROptimized).astJson();
+	return loadGeneratedIR(*optimizedIR)->astJson();
 }
 
 evmasm::LinkerObject const& CompilerStack::object(std::string const& _contractName) const
@@ -1214,13 +1378,28 @@ Json CompilerStack::ethdebug(Contract const& _contract, bool _runtime) const
 	solAssert(m_stackState >= AnalysisSuccessful, "Analysis was not successful.");
 	solAssert(_contract.contract);
 	solUnimplementedAssert(!isExperimentalSolidity());
-	evmasm::LinkerObject const& object = _runtime ? _contract.runtimeObject : _contract.object;
 	std::shared_ptr<evmasm::Assembly> const& assembly = _runtime ? _contract.evmRuntimeAssembly : _contract.evmAssembly;
 	if (!assembly)
 		return {};
 
 	solAssert(sourceIndices().contains(_contract.contract->sourceUnitName()));
-	return evmasm::ethdebug::program(_contract.contract->name(), sourceIndices()[_contract.contract->sourceUnitName()], *assembly, object);
+	return evmasm::ethdebug::program(
+		_contract.contract->name(),
+		sourceIndices()[_contract.contract->sourceUnitName()],
+		*assembly,
+		objectWithDebugData(_contract, _runtime)
+	);
+}
+
+evmasm::LinkerObject const& CompilerStack::objectWithDebugData(Contract const& _contract, bool _runtime) const
+{
+	evmasm::LinkerObject const& object = _runtime ? _contract.runtimeObject : _contract.object;
+	std::shared_ptr<evmasm::Assembly> const& assembly = _runtime ? _contract.evmRuntimeAssembly : _contract.evmAssembly;
+	// Objects assembled with debug data always have at least one code section location.
+	if (!object.codeSectionLocations.empty() || !assembly)
+		return object;
+	// The assembly keeps the object, so that it is assembled at most once more.
+	return assembly->assemble(true /* _debugData */);
 }
 
 bytes CompilerStack::cborMetadata(std::string const& _contractName, bool _forIR) const
@@ -1266,7 +1445,7 @@ size_t CompilerStack::functionEntryPoint(
 {
 	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
 
-	for (auto&& [name, data]: contract(_contractName).runtimeObject.functionDebugData)
+	for (auto&& [name, data]: objectWithDebugData(contract(_contractName), true /* _runtime */).functionDebugData)
 		if (data.sourceID == _function.id())
 			if (data.instructionIndex)
 				return *data.instructionIndex;
@@ -1466,13 +1645,16 @@ void CompilerStack::assembleYul(
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	// The debug data is not needed for the bytecode itself, so it is only produced if an artifact
+	// depending on it was requested. Dependencies compiled as part of another contract use their own selection.
+	bool const debugData = requestedPipelineConfig(_contract).needDebugData();
 
 	compiledContract.evmAssembly = _assembly;
 	solAssert(compiledContract.evmAssembly, "");
 	try
 	{
 		// Assemble deployment (incl. runtime)  object.
-		compiledContract.object = compiledContract.evmAssembly->assemble();
+		compiledContract.object = compiledContract.evmAssembly->assemble(debugData);
 	}
 	catch (evmasm::AssemblyException const& error)
 	{
@@ -1485,7 +1667,7 @@ void CompilerStack::assembleYul(
 	try
 	{
 		// Assemble runtime object.
-		compiledContract.runtimeObject = compiledContract.evmRuntimeAssembly->assemble();
+		compiledContract.runtimeObject = compiledContract.evmRuntimeAssembly->assemble(debugData);
 	}
 	catch (evmasm::AssemblyException const& error)
 	{
@@ -1576,6 +1758,8 @@ void CompilerStack::generateIR(ContractDefinition const& _contract, bool _unopti
 	if (compiledContract.yulIR)
 	{
 		solAssert(!compiledContract.yulIR->empty());
+		if (!_unoptimizedOnly)
+			optimizeIR(compiledContract);
 		return;
 	}
 
@@ -1587,16 +1771,21 @@ void CompilerStack::generateIR(ContractDefinition const& _contract, bool _unopti
 			"Using ABI coder v2 instead."
 		);
 
+	// Only the unoptimized IR of the dependencies is included in the IR of the contract.
 	std::string dependenciesSource;
 	for (auto const& [dependency, referencee]: _contract.annotation().contractDependencies)
-		generateIR(*dependency, _unoptimizedOnly);
+		generateIR(*dependency, true /* _unoptimizedOnly */);
 
 	if (!_contract.canBeDeployed())
 		return;
 
 	std::map<ContractDefinition const*, std::string_view const> otherYulSources;
+	std::map<ContractDefinition const*, std::shared_ptr<yul::Object const>> otherYulObjects;
 	for (auto const& pair: m_contracts)
+	{
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR ? *pair.second.yulIR : std::string_view{});
+		otherYulObjects.emplace(pair.second.contract, pair.second.yulIRObject);
+	}
 
 	if (m_experimentalAnalysis)
 	{
@@ -1624,22 +1813,42 @@ void CompilerStack::generateIR(ContractDefinition const& _contract, bool _unopti
 			sourceIndices(),
 			m_debugInfoSelection,
 			this,
-			m_optimiserSettings
+			m_optimiserSettings,
+			m_sharedYulFunctions
 		);
-		compiledContract.yulIR = generator.run(
+		std::tie(compiledContract.yulIR, compiledContract.yulIRObject) = generator.run(
 			_contract,
 			createCBORMetadata(compiledContract, /* _forIR */ true),
-			otherYulSources
+			otherYulSources,
+			otherYulObjects
 		);
 	}
 
 	yulAssert(compiledContract.yulIR);
-	YulStack stack = loadGeneratedIR(*compiledContract.yulIR);
 	if (!_unoptimizedOnly)
-	{
-		stack.optimize();
-		compiledContract.yulIROptimized = stack.print();
-	}
+		optimizeIR(compiledContract);
+}
+
+void CompilerStack::optimizeIR(Contract& _compiledContract)
+{
+	yulAssert(_compiledContract.yulIR);
+	if (
+		_compiledContract.yulIROptimizedStack ||
+		_compiledContract.yulIROptimized ||
+		!_compiledContract.object.bytecode.empty()
+	)
+		return;
+
+	std::shared_ptr<YulStack> stack = _compiledContract.yulIRObject ?
+		loadGeneratedIR(*_compiledContract.yulIR, _compiledContract.yulIRObject->copyTree()) :
+		loadGeneratedIR(*_compiledContract.yulIR);
+	stack->optimize();
+	// The optimizer reparses its result, so the AST matches the printed optimized IR and can be
+	// used directly for the code generation. If optimization failed, the unoptimized AST is
+	// printed and parsed again instead, as it is not analyzed any more.
+	if (stack->hasErrors())
+		stack = loadGeneratedIR(stack->print());
+	_compiledContract.yulIROptimizedStack = std::move(stack);
 }
 
 void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
@@ -1650,13 +1859,10 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(compiledContract.yulIROptimized);
-	solAssert(!compiledContract.yulIROptimized->empty());
 	if (!compiledContract.object.bytecode.empty())
 		return;
-
-	// Re-parse the Yul IR in EVM dialect
-	YulStack stack = loadGeneratedIR(*compiledContract.yulIROptimized);
+	solAssert(compiledContract.yulIROptimizedStack);
+	YulStack& stack = *compiledContract.yulIROptimizedStack;
 
 	std::string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
@@ -1678,7 +1884,10 @@ CompilerStack::Contract const& CompilerStack::contract(std::string const& _contr
 
 	auto it = m_contracts.find(_contractName);
 	if (it != m_contracts.end())
+	{
+		solAssert(!it->second.released, "Artifacts of contract \"" + _contractName + "\" were already released.");
 		return it->second;
+	}
 
 	// To provide a measure of backward-compatibility, if a contract is not located by its
 	// fully-qualified name, a lookup will be attempted purely on the contract's name to see
@@ -1695,7 +1904,10 @@ CompilerStack::Contract const& CompilerStack::contract(std::string const& _contr
 			getline(ss, source, ':');
 			getline(ss, foundName, ':');
 			if (foundName == _contractName)
+			{
+				solAssert(!contractEntry.second.released, "Artifacts of contract \"" + _contractName + "\" were already released.");
 				return contractEntry.second;
+			}
 		}
 	}
 
@@ -1757,11 +1969,14 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 	static_assert(sizeof(m_optimiserSettings.expectedExecutionsPerDeployment) <= sizeof(Json::number_integer_t), "Invalid word size.");
 	solAssert(static_cast<Json::number_integer_t>(m_optimiserSettings.expectedExecutionsPerDeployment) < std::numeric_limits<Json::number_integer_t>::max(), "");
 	meta["settings"]["optimizer"]["runs"] = Json::number_integer_t(m_optimiserSettings.expectedExecutionsPerDeployment);
+	if (!m_optimiserSettings.executionProfile.empty())
+		meta["settings"]["optimizer"]["profileData"] = m_optimiserSettings.executionProfile.toJson();
 
 	/// Backwards compatibility: If set to one of the default settings, do not provide details.
 	OptimiserSettings settingsWithoutRuns = m_optimiserSettings;
 	// reset to default
 	settingsWithoutRuns.expectedExecutionsPerDeployment = OptimiserSettings::minimal().expectedExecutionsPerDeployment;
+	settingsWithoutRuns.executionProfile = {};
 	if (settingsWithoutRuns == OptimiserSettings::minimal())
 		meta["settings"]["optimizer"]["enabled"] = false;
 	else if (settingsWithoutRuns == OptimiserSettings::standard())
@@ -1779,6 +1994,12 @@ std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR
 		details["constantOptimizer"] = m_optimiserSettings.runConstantOptimiser;
 		details["simpleCounterForLoopUncheckedIncrement"] = m_optimiserSettings.simpleCounterForLoopUncheckedIncrement;
 		details["yul"] = m_optimiserSettings.runYulOptimiser;
+		if (!m_optimiserSettings.dispatcherSelectorOrder.empty())
+		{
+			details["dispatcherSelectorOrder"] = Json::array();
+			for (uint32_t selector: m_optimiserSettings.dispatcherSelectorOrder)
+				details["dispatcherSelectorOrder"].emplace_back(util::FixedHash<4>(util::FixedHash<4>::Arith(selector)).hex());
+		}
 		if (m_optimiserSettings.runYulOptimiser)
 		{
 			details["yulDetails"] = Json::object();
@@ -1970,11 +2191,16 @@ Json gasToJson(GasEstimator::GasConsumption const& _gas)
 
 }
 
-Json CompilerStack::gasEstimates(std::string const& _contractName) const
+Json const& CompilerStack::gasEstimates(std::string const& _contractName) const
 {
 	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
 	solUnimplementedAssert(!isExperimentalSolidity());
 
+	return contract(_contractName).gasEstimates.init([&]{ return computeGasEstimates(_contractName); });
+}
+
+Json CompilerStack::computeGasEstimates(std::string const& _contractName) const
+{
 	if (!assemblyItems(_contractName) && !runtimeAssemblyItems(_contractName))
 		return Json();
 
@@ -1998,26 +2224,32 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 
 	if (evmasm::AssemblyItems const* items = runtimeAssemblyItems(_contractName))
 	{
+		/// The functions are estimated independently of each other. Everything that needs the AST
+		/// is prepared here, only the estimations themselves run in parallel.
+		struct FunctionEstimation
+		{
+			std::string category;
+			std::string signature;
+			std::function<Gas()> estimate;
+			Gas gas = Gas::infinite();
+		};
+		std::vector<FunctionEstimation> estimations;
+
 		/// External functions
 		ContractDefinition const& contract = contractDefinition(_contractName);
-		Json externalFunctions = Json::object();
 		for (auto it: contract.interfaceFunctions())
 		{
 			std::string sig = it.second->externalSignature();
-			externalFunctions[sig] = gasToJson(gasEstimator.functionalEstimation(*items, sig));
+			estimations.push_back({"external", sig, [=, &gasEstimator]{ return gasEstimator.functionalEstimation(*items, sig); }});
 		}
 
 		if (contract.fallbackFunction())
 			/// This needs to be set to an invalid signature in order to trigger the fallback,
 			/// without the shortcut (of CALLDATSIZE == 0), and therefore to receive the upper bound.
 			/// An empty string ("") would work to trigger the shortcut only.
-			externalFunctions[""] = gasToJson(gasEstimator.functionalEstimation(*items, "INVALID"));
-
-		if (!externalFunctions.empty())
-			output["external"] = externalFunctions;
+			estimations.push_back({"external", "", [=, &gasEstimator]{ return gasEstimator.functionalEstimation(*items, "INVALID"); }});
 
 		/// Internal functions
-		Json internalFunctions = Json::object();
 		for (auto const& it: contract.definedFunctions())
 		{
 			/// Exclude externally visible functions, constructor, fallback and receive ether function
@@ -2025,9 +2257,9 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 				continue;
 
 			size_t entry = functionEntryPoint(_contractName, *it);
-			GasEstimator::GasConsumption gas = GasEstimator::GasConsumption::infinite();
+			std::function<Gas()> estimate = []{ return Gas::infinite(); };
 			if (entry > 0)
-				gas = gasEstimator.functionalEstimation(*items, entry, *it);
+				estimate = [=, &gasEstimator, function = it]{ return gasEstimator.functionalEstimation(*items, entry, *function); };
 
 			/// TODO: This could move into a method shared with externalSignature()
 			FunctionType type(*it);
@@ -2037,16 +2269,42 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 				sig += (*it)->toString() + (it + 1 == paramTypes.end() ? "" : ",");
 			sig += ")";
 
-			internalFunctions[sig] = gasToJson(gas);
+			estimations.push_back({"internal", sig, std::move(estimate)});
 		}
 
-		if (!internalFunctions.empty())
-			output["internal"] = internalFunctions;
+		std::vector<std::exception_ptr> exceptions = runInParallel(m_analysisThreads, estimations.size(), [&](size_t _index) {
+			estimations[_index].gas = estimations[_index].estimate();
+		});
+		for (std::exception_ptr const& exception: exceptions)
+			if (exception)
+				std::rethrow_exception(exception);
+		for (FunctionEstimation const& estimation: estimations)
+			output[estimation.category][estimation.signature] = gasToJson(estimation.gas);
 	}
 
 	return output;
 }
 
+void CompilerStack::releaseContract(std::string const& _contractName)
+{
+	solAssert(m_stackState >= AnalysisSuccessful, "");
+
+	Contract& released = m_contracts.at(_contractName);
+	released.evmAssembly.reset();
+	released.evmRuntimeAssembly.reset();
+	released.generatedYulUtilityCode.reset();
+	released.runtimeGeneratedYulUtilityCode.reset();
+	released.object = {};
+	released.runtimeObject = {};
+	released.yulIR.reset();
+	released.yulIRObject.reset();
+	released.yulIROptimizedStack.reset();
+	released.yulIROptimized.reset();
+	released.sourceMapping.reset();
+	released.runtimeSourceMapping.reset();
+	released.released = true;
+}
+
 bool CompilerStack::isExperimentalSolidity() const
 {
 	return
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <libsolidity/analysis/FunctionCallGraph.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/ImportRemapper.h>
 #include <libsolidity/interface/OptimiserSettings.h>
@@ -73,6 +74,7 @@ using AssemblyItems = std::vector<AssemblyItem>;
 
 namespace solidity::yul
 {
+class Object;
 class YulStack;
 }
 
@@ -141,6 +143,7 @@ public:
 		bool irCodegen = false;      ///< Want IR output straight from code generator.
 		bool irOptimization = false; ///< Want reparsed IR that went through YulStack. May be optimized or not, depending on settings.
 		bool bytecode = false;       ///< Want EVM-level outputs, especially EVM assembly and bytecode. May be optimized or not, depending on settings.
+		bool debugData = false;      ///< Want the function debug data and instruction locations of the bytecode. Gas estimates and ethdebug assemble the bytecode again if they need it and it was not selected.
 
 		bool needIR(bool _viaIR) const
 		{
@@ -160,12 +163,18 @@ public:
 			return bytecode;
 		}
 
+		bool needDebugData() const
+		{
+			return bytecode && debugData;
+		}
+
 		PipelineConfig operator|(PipelineConfig const& _other) const
 		{
 			return {
 				irCodegen || _other.irCodegen,
 				irOptimization || _other.irOptimization,
 				bytecode || _other.bytecode,
+				debugData || _other.debugData,
 			};
 		}
 
@@ -175,7 +184,8 @@ public:
 			return
 				irCodegen == _other.irCodegen &&
 				irOptimization == _other.irOptimization &&
-				bytecode == _other.bytecode;
+				bytecode == _other.bytecode &&
+				debugData == _other.debugData;
 		}
 	};
 
@@ -235,6 +245,12 @@ public:
 	/// Set model checker settings.
 	void setModelCheckerSettings(ModelCheckerSettings _settings);
 
+	/// Sets the maximum number of threads used to analyse independent source units and to
+	/// estimate the gas of independent functions.
+	/// The reported errors and estimates do not depend on it. Defaults to 1.
+	/// Must be set before analysis.
+	void setAnalysisThreads(size_t _threads);
+
 	/// Sets names of the contracts from each source that should be compiled.
 	/// If empty, no filtering is performed and every contract found in the supplied sources goes
 	/// through the default pipeline stages (bytecode-only, no IR).
@@ -268,7 +284,7 @@ public:
 
 	/// Imports given SourceUnits so they can be analyzed. Leads to the same internal state as parse().
 	/// Will throw errors if the import fails
-	void importASTs(std::map<std::string, Json> const& _sources);
+	void importASTs(std::map<std::string, Json> _sources);
 
 	/// Performs the analysis steps (imports, scopesetting, syntaxCheck, referenceResolving,
 	///  typechecking, staticAnalysis) on previously parsed sources.
@@ -327,6 +343,7 @@ public:
 	std::optional<Json> yulIRAst(std::string const& _contractName) const;
 
 	/// @returns the optimized IR representation of a contract.
+	/// Only available if the optimized IR was requested in the pipeline configuration of the contract.
 	std::optional<std::string> const& yulIROptimized(std::string const& _contractName) const;
 
 	/// @returns the optimized IR representation of a contract AST in JSON format.
@@ -415,7 +432,13 @@ public:
 	bytes cborMetadata(std::string const& _contractName, bool _forIR) const;
 
 	/// @returns a JSON representing the estimated gas usage for contract creation, internal and external functions
-	Json gasEstimates(std::string const& _contractName) const;
+	/// This will generate the JSON object and store it in the Contract object if it is not present yet.
+	Json const& gasEstimates(std::string const& _contractName) const;
+
+	/// Releases the bytecode, assembly and IR of the contract once its artifacts are no longer
+	/// needed, e.g. after they have been written to the output. The contract is still listed by
+	/// @a contractNames, but none of its artifacts can be requested afterwards.
+	void releaseContract(std::string const& _contractName);
 
 	/// Changes the format of the metadata appended at the end of the bytecode.
 	void setMetadataFormat(MetadataFormat _metadataFormat) { m_metadataFormat = _metadataFormat; }
@@ -458,15 +481,23 @@ private:
 		evmasm::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::optional<std::string> yulIR; ///< Yul IR code straight from the code generator.
-		std::optional<std::string> yulIROptimized; ///< Reparsed and possibly optimized Yul IR code.
+		/// Object tree equivalent to @a yulIR, built by the code generator without parsing @a yulIR.
+		/// Reused by the contracts that create this one and released at the end of the compilation.
+		std::shared_ptr<yul::Object const> yulIRObject;
+		/// Reparsed and possibly optimized Yul IR, used for the EVM code generation. Printed into
+		/// @a yulIROptimized when that is requested and released afterwards.
+		mutable std::shared_ptr<yul::YulStack> yulIROptimizedStack;
+		mutable std::optional<std::string> yulIROptimized; ///< Reparsed and possibly optimized Yul IR code.
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
 		util::LazyInit<Json const> abi;
 		util::LazyInit<Json const> storageLayout;
 		util::LazyInit<Json const> transientStorageLayout;
 		util::LazyInit<Json const> userDocumentation;
 		util::LazyInit<Json const> devDocumentation;
+		util::LazyInit<Json const> gasEstimates;
 		mutable std::optional<std::string const> sourceMapping;
 		mutable std::optional<std::string const> runtimeSourceMapping;
+		bool released = false; ///< Whether the artifacts were released by @a releaseContract.
 	};
 
 	void createAndAssignCallGraphs();
@@ -504,6 +535,14 @@ private:
 	/// @returns false on error.
 	bool analyzeExperimental();
 
+	/// Runs @a _analysis on the AST of every source, each time with an error reporter for the
+	/// errors it finds. Uses up to m_analysisThreads threads for sources that do not import each
+	/// other, as long as no errors were reported, since some checks depend on that. Sources are
+	/// only analysed after the sources they import. The errors of sources analysed concurrently
+	/// are reported in source order.
+	/// @returns false if @a _analysis returned false for any source.
+	bool analyzeEachSource(std::function<bool(SourceUnit const&, langutil::ErrorReporter&)> const& _analysis);
+
 	/// Assembles the contract.
 	/// This function should only be internally called by compileContract and generateEVMFromIR.
 	void assembleYul(
@@ -530,6 +569,10 @@ private:
 	///     optimized IR, its AST or compilation via IR must not be requested.
 	void generateIR(ContractDefinition const& _contract, bool _unoptimizedOnly);
 
+	/// Parses, analyzes and optimizes the IR of a contract and stores the resulting YulStack.
+	/// Does nothing if this already happened.
+	void optimizeIR(Contract& _compiledContract);
+
 	/// Generate EVM representation for a single contract.
 	/// Depends on output generated by generateIR.
 	void generateEVMFromIR(ContractDefinition const& _contract);
@@ -541,7 +584,9 @@ private:
 	/// Parses and analyzes specified Yul source and returns the YulStack that can be used to manipulate it.
 	/// Assumes that the IR was generated from sources loaded currently into CompilerStack, which
 	/// means that it is error-free and uses the same settings.
-	yul::YulStack loadGeneratedIR(std::string const& _ir) const;
+	std::unique_ptr<yul::YulStack> loadGeneratedIR(std::string const& _ir) const;
+	/// Same as above, but uses @a _object, which has to be equivalent to @a _ir, instead of parsing @a _ir.
+	std::unique_ptr<yul::YulStack> loadGeneratedIR(std::string const& _ir, std::shared_ptr<yul::Object> _object) const;
 
 	/// @returns the contract object for the given @a _contractName.
 	/// Can only be called after state is CompilationSuccessful.
@@ -583,6 +628,13 @@ private:
 	/// This will generate the metadata and store it in the Contract object if it is not present yet.
 	std::string const& metadata(Contract const& _contract) const;
 
+	/// @returns the estimated gas usage of the contract without storing it in the Contract object.
+	Json computeGasEstimates(std::string const& _contractName) const;
+
+	/// @returns the deployment or runtime object of the contract including the debug data.
+	/// If the debug data was not selected, the assembly is assembled again to produce it.
+	evmasm::LinkerObject const& objectWithDebugData(Contract const& _contract, bool _runtime) const;
+
 	/// @returns the Contract ethdebug data.
 	/// This will generate the JSON object and store it in the Contract object if it is not present yet.
 	/// Prerequisite: Successful call to parse or compile.
@@ -610,6 +662,7 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
+	size_t m_analysisThreads = 1;
 	ContractSelection m_selectedContracts;
 	std::map<std::string, util::h160> m_libraries;
 	ImportRemapper m_importRemapper;
@@ -621,6 +674,8 @@ private:
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
 	std::shared_ptr<yul::ObjectOptimizer> m_objectOptimizer;
+	/// Yul utility functions generated for the IR of one contract and reused for the others.
+	std::shared_ptr<MultiUseYulFunctionCollector::SharedFunctions> m_sharedYulFunctions;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
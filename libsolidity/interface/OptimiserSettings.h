@@ -24,9 +24,12 @@
 #pragma once
 
 #include <liblangutil/Exceptions.h>
+#include <liblangutil/ExecutionProfile.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -151,6 +154,14 @@ struct OptimiserSettings
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
+	/// Function selectors the external function dispatcher of the IR code generator checks first,
+	/// in the given order. Meant for the most frequently called functions. Selectors not
+	/// present in the contract are ignored.
+	std::vector<uint32_t> dispatcherSelectorOrder;
+	/// Execution counts recorded from real transactions. If present, they are used to weight
+	/// the number of expected executions of individual pieces of code against each other
+	/// and to order the external function dispatcher if @a dispatcherSelectorOrder is empty.
+	langutil::ExecutionProfile executionProfile;
 };
 
 }
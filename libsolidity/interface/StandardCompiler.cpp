@@ -44,6 +44,8 @@
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <algorithm>
+#include <cctype>
+#include <functional>
 #include <optional>
 
 using namespace solidity;
@@ -86,6 +88,50 @@ Json formatFatalError(Error::Type _type, std::string const& _message)
 	return output;
 }
 
+/// @returns the output for the exception that is currently being handled, which was not
+/// handled during the compilation.
+Json formatCurrentException()
+{
+	try
+	{
+		throw;
+	}
+	catch (UnimplementedFeatureError const& _exception)
+	{
+		solAssert(_exception.comment(), "Unimplemented feature errors must include a message for the user");
+		return formatFatalError(Error::Type::UnimplementedFeatureError, stringOrDefault(_exception.comment()));
+	}
+	catch (...)
+	{
+		return formatFatalError(
+			Error::Type::InternalCompilerError,
+			"Uncaught exception:\n" + boost::current_exception_diagnostic_information()
+		);
+	}
+}
+
+/// Writes the members of @a _object to @a _writer in the same order as jsonPrint, with additional
+/// members that are written by the functions in @a _streamedMembers at the position of their names.
+/// These can also decide not to write their member.
+void writeMembers(
+	util::JsonStreamWriter& _writer,
+	Json const& _object,
+	std::map<std::string, std::function<void()>> const& _streamedMembers
+)
+{
+	auto streamedMember = _streamedMembers.begin();
+	for (auto const& [name, value]: _object.items())
+	{
+		solAssert(!_streamedMembers.count(name));
+		for (; streamedMember != _streamedMembers.end() && streamedMember->first < name; ++streamedMember)
+			streamedMember->second();
+		_writer.key(name);
+		_writer.value(value);
+	}
+	for (; streamedMember != _streamedMembers.end(); ++streamedMember)
+		streamedMember->second();
+}
+
 Json formatSourceLocation(SourceLocation const* location)
 {
 	if (!location || !location->sourceName)
@@ -340,6 +386,17 @@ CompilerStack::ContractSelection pipelineConfig(
 					request == "irAst";
 				pipelineForContract.bytecode = isEvmBytecodeRequested(_jsonOutputSelection);
 			}
+			// Builds requesting only the bytecode itself skip the debug data of the assembly.
+			for (std::string const& artifact: {
+				"evm.gasEstimates"s,
+				"evm.bytecode.functionDebugData"s,
+				"evm.deployedBytecode.functionDebugData"s,
+				"evm.bytecode.ethdebug"s,
+				"evm.deployedBytecode.ethdebug"s,
+			})
+				pipelineForContract.debugData =
+					pipelineForContract.debugData ||
+					isArtifactRequested(jsonOutputSelectionForContract, artifact, false);
 			std::string key = (sourceUnitName == "*") ? "" : sourceUnitName;
 			std::string value = (contractName == "*") ? "" : contractName;
 			contractSelection[key][value] = pipelineForContract;
@@ -442,13 +499,13 @@ std::optional<Json> checkModelCheckerSettingsKeys(Json const& _input)
 
 std::optional<Json> checkOptimizerKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"details", "enabled", "runs"};
+	static std::set<std::string> keys{"details", "enabled", "runs", "profileData"};
 	return checkKeys(_input, keys, "settings.optimizer");
 }
 
 std::optional<Json> checkOptimizerDetailsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"peephole", "inliner", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails", "simpleCounterForLoopUncheckedIncrement"};
+	static std::set<std::string> keys{"peephole", "inliner", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails", "simpleCounterForLoopUncheckedIncrement", "dispatcherSelectorOrder"};
 	return checkKeys(_input, keys, "settings.optimizer.details");
 }
 
@@ -463,6 +520,35 @@ std::optional<Json> checkOptimizerDetail(Json const& _details, std::string const
 	return {};
 }
 
+std::optional<Json> checkOptimizerDetailSelectors(Json const& _details, std::string const& _name, std::vector<uint32_t>& _setting)
+{
+	if (_details.contains(_name))
+	{
+		std::string const errorMessage =
+			"\"settings.optimizer.details." + _name + "\" must be an array of function selectors, "
+			"each given as a string of 8 hexadecimal digits.";
+		if (!_details[_name].is_array())
+			return formatFatalError(Error::Type::JSONError, errorMessage);
+
+		_setting.clear();
+		for (Json const& selector: _details[_name])
+		{
+			if (
+				!selector.is_string() ||
+				selector.get<std::string>().size() != 8 ||
+				!std::all_of(
+					selector.get<std::string>().begin(),
+					selector.get<std::string>().end(),
+					[](char _c) { return std::isxdigit(static_cast<unsigned char>(_c)); }
+				)
+			)
+				return formatFatalError(Error::Type::JSONError, errorMessage);
+			_setting.emplace_back(static_cast<uint32_t>(std::stoul(selector.get<std::string>(), nullptr, 16)));
+		}
+	}
+	return {};
+}
+
 std::optional<Json> checkOptimizerDetailSteps(Json const& _details, std::string const& _name, std::string& _optimiserSetting, std::string& _cleanupSetting, bool _runYulOptimizer)
 {
 	if (_details.contains(_name))
@@ -588,6 +674,21 @@ std::variant<OptimiserSettings, Json> parseOptimizerSettings(std::string_view co
 		settings.expectedExecutionsPerDeployment = _jsonInput["runs"].get<size_t>();
 	}
 
+	if (_jsonInput.contains("profileData"))
+	{
+		try
+		{
+			settings.executionProfile = ExecutionProfile::fromJson(_jsonInput["profileData"]);
+		}
+		catch (ProfileDataError const& _error)
+		{
+			return formatFatalError(
+				Error::Type::JSONError,
+				std::string("Invalid \"settings.optimizer.profileData\": ") + _error.what()
+			);
+		}
+	}
+
 	if (_jsonInput.contains("details"))
 	{
 		Json const& details = _jsonInput["details"];
@@ -612,6 +713,8 @@ std::variant<OptimiserSettings, Json> parseOptimizerSettings(std::string_view co
 			return *error;
 		if (auto error = checkOptimizerDetail(details, "simpleCounterForLoopUncheckedIncrement", settings.simpleCounterForLoopUncheckedIncrement))
 			return *error;
+		if (auto error = checkOptimizerDetailSelectors(details, "dispatcherSelectorOrder", settings.dispatcherSelectorOrder))
+			return *error;
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
 		if (details.contains("yulDetails"))
 		{
@@ -1348,7 +1451,7 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 	return util::removeNullMembers(output);
 }
 
-Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _writer)
 {
 	solAssert(_inputsAndSettings.jsonSources.empty());
 
@@ -1494,146 +1597,238 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::object();
-	unsigned sourceIndex = 0;
 	// NOTE: A case that will pass `parsingSuccess && !analysisFailed` but not `analysisSuccess` is
 	// stopAfter: parsing with no parsing errors.
-	if (parsingSuccess && !analysisFailed)
-		for (std::string const& sourceName: compilerStack.sourceNames())
-		{
-			Json sourceResult;
-			sourceResult["id"] = sourceIndex++;
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
-				sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
-		}
+	bool const sourcesAvailable = parsingSuccess && !analysisFailed;
+	auto const astRequested = [&](std::string const& _sourceName) {
+		return isArtifactRequested(_inputsAndSettings.outputSelection, _sourceName, "", "ast", wildcardMatchesExperimental);
+	};
 
-	Json contractsOutput;
+	// Contract names by source unit and name, i.e. in the order of the output.
+	std::map<std::string, std::map<std::string, std::string>> contractNames;
 	for (std::string const& contractName: analysisSuccess ? compilerStack.contractNames() : std::vector<std::string>())
 	{
 		size_t colon = contractName.rfind(':');
 		solAssert(colon != std::string::npos, "");
-		std::string file = contractName.substr(0, colon);
-		std::string name = contractName.substr(colon + 1);
+		contractNames[contractName.substr(0, colon)][contractName.substr(colon + 1)] = contractName;
+	}
 
+	auto const contractOutput = [&](std::string const& _file, std::string const& _name, std::string const& _contractName) {
 		// ABI, storage layout, documentation and metadata
 		Json contractData;
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "abi", wildcardMatchesExperimental))
-			contractData["abi"] = compilerStack.contractABI(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "storageLayout", false))
-			contractData["storageLayout"] = compilerStack.storageLayout(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "transientStorageLayout", false))
-			contractData["transientStorageLayout"] = compilerStack.transientStorageLayout(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "metadata", wildcardMatchesExperimental))
-			contractData["metadata"] = compilerStack.metadata(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "userdoc", wildcardMatchesExperimental))
-			contractData["userdoc"] = compilerStack.natspecUser(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "devdoc", wildcardMatchesExperimental))
-			contractData["devdoc"] = compilerStack.natspecDev(contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "abi", wildcardMatchesExperimental))
+			contractData["abi"] = compilerStack.contractABI(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "storageLayout", false))
+			contractData["storageLayout"] = compilerStack.storageLayout(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "transientStorageLayout", false))
+			contractData["transientStorageLayout"] = compilerStack.transientStorageLayout(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "metadata", wildcardMatchesExperimental))
+			contractData["metadata"] = compilerStack.metadata(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "userdoc", wildcardMatchesExperimental))
+			contractData["userdoc"] = compilerStack.natspecUser(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "devdoc", wildcardMatchesExperimental))
+			contractData["devdoc"] = compilerStack.natspecDev(_contractName);
 
 		// IR
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ir", wildcardMatchesExperimental))
-			contractData["ir"] = compilerStack.yulIR(contractName).value_or("");
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irAst", wildcardMatchesExperimental))
-			contractData["irAst"] = compilerStack.yulIRAst(contractName).value_or(Json{});
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
-			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName).value_or("");
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimizedAst", wildcardMatchesExperimental))
-			contractData["irOptimizedAst"] = compilerStack.yulIROptimizedAst(contractName).value_or(Json{});
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "yulCFGJson", wildcardMatchesExperimental))
-			contractData["yulCFGJson"] = compilerStack.yulCFGJson(contractName).value_or(Json{});
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "ir", wildcardMatchesExperimental))
+			contractData["ir"] = compilerStack.yulIR(_contractName).value_or("");
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "irAst", wildcardMatchesExperimental))
+			contractData["irAst"] = compilerStack.yulIRAst(_contractName).value_or(Json{});
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "irOptimized", wildcardMatchesExperimental))
+			contractData["irOptimized"] = compilerStack.yulIROptimized(_contractName).value_or("");
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "irOptimizedAst", wildcardMatchesExperimental))
+			contractData["irOptimizedAst"] = compilerStack.yulIROptimizedAst(_contractName).value_or(Json{});
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "yulCFGJson", wildcardMatchesExperimental))
+			contractData["yulCFGJson"] = compilerStack.yulCFGJson(_contractName).value_or(Json{});
 
 		// EVM
 		Json evmData;
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
-			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
-			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
-			evmData["methodIdentifiers"] = compilerStack.interfaceSymbols(contractName)["methods"];
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
-			evmData["gasEstimates"] = compilerStack.gasEstimates(contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.assembly", wildcardMatchesExperimental))
+			evmData["assembly"] = compilerStack.assemblyString(_contractName, sourceList);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.legacyAssembly", wildcardMatchesExperimental))
+			evmData["legacyAssembly"] = compilerStack.assemblyJSON(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.methodIdentifiers", wildcardMatchesExperimental))
+			evmData["methodIdentifiers"] = compilerStack.interfaceSymbols(_contractName)["methods"];
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.gasEstimates", wildcardMatchesExperimental))
+			evmData["gasEstimates"] = compilerStack.gasEstimates(_contractName);
 
 		if (compilationSuccess && isArtifactRequested(
 			_inputsAndSettings.outputSelection,
-			file,
-			name,
+			_file,
+			_name,
 			evmObjectComponents("bytecode"),
 			wildcardMatchesExperimental
 		))
 		{
 			auto const evmCreationArtifactRequested = [&](std::string const& _element) {
-				return isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.bytecode." + _element, wildcardMatchesExperimental);
+				return isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.bytecode." + _element, wildcardMatchesExperimental);
 			};
 
 			Json creationJSON;
 			if (evmCreationArtifactRequested("object"))
-				creationJSON["object"] = compilerStack.object(contractName).toHex();
+				creationJSON["object"] = compilerStack.object(_contractName).toHex();
 			if (evmCreationArtifactRequested("opcodes"))
-				creationJSON["opcodes"] = evmasm::disassemble(compilerStack.object(contractName).bytecode, _inputsAndSettings.evmVersion);
+				creationJSON["opcodes"] = evmasm::disassemble(compilerStack.object(_contractName).bytecode, _inputsAndSettings.evmVersion);
 			if (evmCreationArtifactRequested("sourceMap"))
-				creationJSON["sourceMap"] = compilerStack.sourceMapping(contractName) ? *compilerStack.sourceMapping(contractName) : "";
+				creationJSON["sourceMap"] = compilerStack.sourceMapping(_contractName) ? *compilerStack.sourceMapping(_contractName) : "";
 			if (evmCreationArtifactRequested("functionDebugData"))
-				creationJSON["functionDebugData"] = formatFunctionDebugData(compilerStack.object(contractName).functionDebugData);
+				creationJSON["functionDebugData"] = formatFunctionDebugData(compilerStack.object(_contractName).functionDebugData);
 			if (evmCreationArtifactRequested("linkReferences"))
-				creationJSON["linkReferences"] = formatLinkReferences(compilerStack.object(contractName).linkReferences);
+				creationJSON["linkReferences"] = formatLinkReferences(compilerStack.object(_contractName).linkReferences);
 			if (evmCreationArtifactRequested("generatedSources"))
-				creationJSON["generatedSources"] = compilerStack.generatedSources(contractName, /* _runtime */ false);
+				creationJSON["generatedSources"] = compilerStack.generatedSources(_contractName, /* _runtime */ false);
 			if (evmCreationArtifactRequested("ethdebug"))
-				creationJSON["ethdebug"] = compilerStack.ethdebug(contractName);
-			evmData["bytecode"] = creationJSON;
+				creationJSON["ethdebug"] = compilerStack.ethdebug(_contractName);
+			evmData["bytecode"] = std::move(creationJSON);
 		}
 
 		if (compilationSuccess && isArtifactRequested(
 			_inputsAndSettings.outputSelection,
-			file,
-			name,
+			_file,
+			_name,
 			evmObjectComponents("deployedBytecode"),
 			wildcardMatchesExperimental
 		))
 		{
 			auto const evmDeployedArtifactRequested = [&](std::string const& _element) {
-				return isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.deployedBytecode." + _element, wildcardMatchesExperimental);
+				return isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.deployedBytecode." + _element, wildcardMatchesExperimental);
 			};
 
 			Json deployedJSON;
 			if (evmDeployedArtifactRequested("object"))
-				deployedJSON["object"] = compilerStack.runtimeObject(contractName).toHex();
+				deployedJSON["object"] = compilerStack.runtimeObject(_contractName).toHex();
 			if (evmDeployedArtifactRequested("opcodes"))
-				deployedJSON["opcodes"] = evmasm::disassemble(compilerStack.runtimeObject(contractName).bytecode, _inputsAndSettings.evmVersion);
+				deployedJSON["opcodes"] = evmasm::disassemble(compilerStack.runtimeObject(_contractName).bytecode, _inputsAndSettings.evmVersion);
 			if (evmDeployedArtifactRequested("sourceMap"))
-				deployedJSON["sourceMap"] = compilerStack.runtimeSourceMapping(contractName) ? *compilerStack.runtimeSourceMapping(contractName) : "";
+				deployedJSON["sourceMap"] = compilerStack.runtimeSourceMapping(_contractName) ? *compilerStack.runtimeSourceMapping(_contractName) : "";
 			if (evmDeployedArtifactRequested("functionDebugData"))
-				deployedJSON["functionDebugData"] = formatFunctionDebugData(compilerStack.runtimeObject(contractName).functionDebugData);
+				deployedJSON["functionDebugData"] = formatFunctionDebugData(compilerStack.runtimeObject(_contractName).functionDebugData);
 			if (evmDeployedArtifactRequested("linkReferences"))
-				deployedJSON["linkReferences"] = formatLinkReferences(compilerStack.runtimeObject(contractName).linkReferences);
+				deployedJSON["linkReferences"] = formatLinkReferences(compilerStack.runtimeObject(_contractName).linkReferences);
 			if (evmDeployedArtifactRequested("immutableReferences"))
-				deployedJSON["immutableReferences"] = formatImmutableReferences(compilerStack.runtimeObject(contractName).immutableReferences);
+				deployedJSON["immutableReferences"] = formatImmutableReferences(compilerStack.runtimeObject(_contractName).immutableReferences);
 			if (evmDeployedArtifactRequested("generatedSources"))
-				deployedJSON["generatedSources"] = compilerStack.generatedSources(contractName, /* _runtime */ true);
+				deployedJSON["generatedSources"] = compilerStack.generatedSources(_contractName, /* _runtime */ true);
 			if (evmDeployedArtifactRequested("ethdebug"))
-				deployedJSON["ethdebug"] = compilerStack.ethdebugRuntime(contractName);
-			evmData["deployedBytecode"] = deployedJSON;
+				deployedJSON["ethdebug"] = compilerStack.ethdebugRuntime(_contractName);
+			evmData["deployedBytecode"] = std::move(deployedJSON);
 		}
 
 		if (!evmData.empty())
-			contractData["evm"] = evmData;
-
-		if (!contractData.empty())
-		{
-			if (!contractsOutput.contains(file))
-				contractsOutput[file] = Json::object();
-			contractsOutput[file][name] = contractData;
-		}
-	}
+			contractData["evm"] = std::move(evmData);
+		return contractData;
+	};
 
 	if (isEthdebugRequested(_inputsAndSettings.outputSelection))
 		output["ethdebug"] = compilerStack.ethdebug();
 
-	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
+	if (!_writer)
+	{
+		output["sources"] = Json::object();
+		unsigned sourceIndex = 0;
+		if (sourcesAvailable)
+			for (std::string const& sourceName: compilerStack.sourceNames())
+			{
+				Json sourceResult;
+				sourceResult["id"] = sourceIndex++;
+				if (astRequested(sourceName))
+					sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
+				output["sources"][sourceName] = std::move(sourceResult);
+			}
+
+		Json contractsOutput;
+		for (auto const& [file, names]: contractNames)
+			for (auto const& [name, contractName]: names)
+				if (Json contractData = contractOutput(file, name, contractName); !contractData.empty())
+					contractsOutput[file][name] = std::move(contractData);
+		if (!contractsOutput.empty())
+			output["contracts"] = std::move(contractsOutput);
 
-	return output;
+		return output;
+	}
+
+	// The members written so far cannot be taken back if an exception occurs while streaming a member.
+	// Its open objects are closed and the error is reported in "errors", which is therefore written last.
+	Json streamedErrors = output.contains("errors") ? std::move(output["errors"]) : Json::array();
+	output.erase("errors");
+	auto reportingErrors = [&](std::function<void()> _writeMember) {
+		return [&, writeMember = std::move(_writeMember)]() {
+			size_t const depth = _writer->depth();
+			try
+			{
+				writeMember();
+			}
+			catch (...)
+			{
+				_writer->close(depth);
+				streamedErrors.emplace_back(formatCurrentException()["errors"][0]);
+			}
+		};
+	};
+
+	_writer->beginObject();
+	writeMembers(*_writer, output, {
+		{"contracts", reportingErrors([&]() {
+			bool contractsWritten = false;
+			for (auto const& [file, names]: contractNames)
+			{
+				bool fileWritten = false;
+				for (auto const& [name, contractName]: names)
+				{
+					Json contractData = contractOutput(file, name, contractName);
+					compilerStack.releaseContract(contractName);
+					if (contractData.empty())
+						continue;
+
+					if (!contractsWritten)
+					{
+						_writer->key("contracts");
+						_writer->beginObject();
+						contractsWritten = true;
+					}
+					if (!fileWritten)
+					{
+						_writer->key(file);
+						_writer->beginObject();
+						fileWritten = true;
+					}
+					_writer->key(name);
+					_writer->value(contractData);
+				}
+				if (fileWritten)
+					_writer->endObject();
+			}
+			if (contractsWritten)
+				_writer->endObject();
+		})},
+		{"sources", reportingErrors([&]() {
+			_writer->key("sources");
+			_writer->beginObject();
+			unsigned sourceIndex = 0;
+			if (sourcesAvailable)
+				for (std::string const& sourceName: compilerStack.sourceNames())
+				{
+					_writer->key(sourceName);
+					_writer->beginObject();
+					if (astRequested(sourceName))
+					{
+						_writer->key("ast");
+						ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).write(*_writer, compilerStack.ast(sourceName));
+					}
+					_writer->key("id");
+					_writer->value(sourceIndex++);
+					_writer->endObject();
+				}
+			_writer->endObject();
+		})}
+	});
+	if (!streamedErrors.empty())
+	{
+		_writer->key("errors");
+		_writer->value(streamedErrors);
+	}
+	_writer->endObject();
+	return Json();
 }
 
 
@@ -1793,6 +1988,11 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 }
 
 Json StandardCompiler::compile(Json const& _input) noexcept
+{
+	return compile(_input, nullptr);
+}
+
+Json StandardCompiler::compile(Json const& _input, util::JsonStreamWriter* _writer) noexcept
 {
 	YulStringRepository::reset();
 
@@ -1803,27 +2003,19 @@ Json StandardCompiler::compile(Json const& _input) noexcept
 			return std::get<Json>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
 		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
+			return compileSolidity(std::move(settings), _writer);
 		else if (settings.language == "Yul")
 			return compileYul(std::move(settings));
 		else if (settings.language == "SolidityAST")
-			return compileSolidity(std::move(settings));
+			return compileSolidity(std::move(settings), _writer);
 		else if (settings.language == "EVMAssembly")
 			return importEVMAssembly(std::move(settings));
 		else
 			return formatFatalError(Error::Type::JSONError, "Only \"Solidity\", \"Yul\", \"SolidityAST\" or \"EVMAssembly\" is supported as a language.");
 	}
-	catch (UnimplementedFeatureError const& _exception)
-	{
-		solAssert(_exception.comment(), "Unimplemented feature errors must include a message for the user");
-		return formatFatalError(Error::Type::UnimplementedFeatureError, stringOrDefault(_exception.comment()));
-	}
 	catch (...)
 	{
-		return formatFatalError(
-			Error::Type::InternalCompilerError,
-			"Uncaught exception:\n" + boost::current_exception_diagnostic_information()
-		);
+		return formatCurrentException();
 	}
 }
 
@@ -1858,6 +2050,62 @@ std::string StandardCompiler::compile(std::string const& _input) noexcept
 	}
 }
 
+void StandardCompiler::compile(std::string const& _input, std::ostream& _output) noexcept
+{
+	Json input;
+	bool parsed = false;
+	try
+	{
+		parsed = util::jsonParseStrict(_input, input);
+	}
+	catch (...)
+	{
+	}
+	if (!parsed)
+	{
+		// Reports the error in the same way.
+		_output << compile(_input);
+		return;
+	}
+
+	util::JsonStreamWriter writer(_output, m_jsonPrintingFormat);
+	try
+	{
+		// Null if the output was already written.
+		Json output = compile(input, &writer);
+		if (output.is_null())
+			return;
+		if (writer.depth() == 0)
+		{
+			writer.value(output);
+			return;
+		}
+		// The error interrupted the streamed output. Report it last, like errors while streaming a member.
+		writer.close(1);
+		writer.key("errors");
+		writer.value(output["errors"]);
+		writer.endObject();
+	}
+	catch (...)
+	{
+		if (writer.depth() == 0)
+		{
+			_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+			return;
+		}
+		try
+		{
+			writer.close(1);
+			writer.key("errors");
+			writer.value(formatFatalError(Error::Type::JSONError, "Error writing output JSON.")["errors"]);
+			writer.endObject();
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
 Json StandardCompiler::formatFunctionDebugData(
 	std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
 )
@@ -62,6 +62,12 @@ public:
 	/// Parses input as JSON and performs the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Same as the above, but writes the output to @a _output while it is assembled. The artifacts of
+	/// Solidity contracts and the ASTs are serialized one at a time and released afterwards, so the
+	/// output of a large project is never held in memory as a whole. The output has the same members,
+	/// but "errors" comes last: If generating an artifact fails, the artifacts written before are not
+	/// taken back and the error is reported after them.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
 
 	static Json formatFunctionDebugData(
 		std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
@@ -97,7 +103,10 @@ private:
 
 	std::map<std::string, Json> parseAstFromInput(StringMap const& _sources);
 	Json importEVMAssembly(InputsAndSettings _inputsAndSettings);
-	Json compileSolidity(InputsAndSettings _inputsAndSettings);
+	/// Performs the processing steps of @a compile. If @a _writer is given, Solidity output is written
+	/// to it and null is returned instead.
+	Json compile(Json const& _input, util::JsonStreamWriter* _writer) noexcept;
+	Json compileSolidity(InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _writer = nullptr);
 	Json compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
@@ -138,6 +138,110 @@ std::string jsonPrint(Json const& _input, JsonFormat const& _format)
 	return dumped;
 }
 
+void JsonStreamWriter::beginObject()
+{
+	beginValue();
+	m_stream << '{';
+	m_levels.push_back({true, true});
+}
+
+void JsonStreamWriter::endObject()
+{
+	end(true);
+}
+
+void JsonStreamWriter::beginArray()
+{
+	beginValue();
+	m_stream << '[';
+	m_levels.push_back({false, true});
+}
+
+void JsonStreamWriter::endArray()
+{
+	end(false);
+}
+
+void JsonStreamWriter::key(std::string const& _name)
+{
+	assertThrow(!m_levels.empty() && m_levels.back().isObject && !m_expectingValue, Exception, "Member name outside of an object.");
+	beginElement();
+	m_stream << Json(_name).dump(-1, ' ', true) << (pretty() ? ": " : ":");
+	m_expectingValue = true;
+}
+
+void JsonStreamWriter::value(Json const& _value)
+{
+	std::string const dumped = _value.dump(pretty() ? static_cast<int>(m_format.indent) : -1, ' ', true);
+	beginValue();
+	if (!pretty())
+	{
+		m_stream << dumped;
+		return;
+	}
+	// Line breaks only occur between tokens, so the nested value can be indented line by line.
+	std::string const lineBreak = "\n" + indentation(m_levels.size());
+	size_t lineStart = 0;
+	for (size_t lineEnd = dumped.find('\n'); lineEnd != std::string::npos; lineEnd = dumped.find('\n', lineStart))
+	{
+		m_stream.write(dumped.data() + lineStart, static_cast<std::streamsize>(lineEnd - lineStart));
+		m_stream << lineBreak;
+		lineStart = lineEnd + 1;
+	}
+	m_stream.write(dumped.data() + lineStart, static_cast<std::streamsize>(dumped.size() - lineStart));
+}
+
+void JsonStreamWriter::close(size_t _depth)
+{
+	assertThrow(_depth <= m_levels.size(), Exception, "Cannot close more levels than are open.");
+	if (m_expectingValue)
+		value(Json());
+	while (m_levels.size() > _depth)
+		end(m_levels.back().isObject);
+}
+
+void JsonStreamWriter::beginElement()
+{
+	assertThrow(!m_levels.empty(), Exception, "");
+	if (!m_levels.back().empty)
+		m_stream << ',';
+	m_levels.back().empty = false;
+	if (pretty())
+		m_stream << '\n' << indentation(m_levels.size());
+}
+
+void JsonStreamWriter::beginValue()
+{
+	if (m_levels.empty())
+		return;
+	if (m_levels.back().isObject)
+	{
+		assertThrow(m_expectingValue, Exception, "Object members need a name.");
+		m_expectingValue = false;
+	}
+	else
+		beginElement();
+}
+
+void JsonStreamWriter::end(bool _isObject)
+{
+	assertThrow(
+		!m_levels.empty() && m_levels.back().isObject == _isObject && !m_expectingValue,
+		Exception,
+		"Unbalanced JSON document."
+	);
+	bool const empty = m_levels.back().empty;
+	m_levels.pop_back();
+	if (pretty() && !empty)
+		m_stream << '\n' << indentation(m_levels.size());
+	m_stream << (_isObject ? '}' : ']');
+}
+
+std::string JsonStreamWriter::indentation(size_t _depth) const
+{
+	return std::string(_depth * m_format.indent, ' ');
+}
+
 bool jsonParseStrict(std::string const& _input, Json& _json, std::string* _errs /* = nullptr */)
 {
 	try
@@ -29,7 +29,9 @@
 #include <string>
 #include <string_view>
 #include <optional>
+#include <ostream>
 #include <limits>
+#include <vector>
 
 namespace solidity
 {
@@ -71,6 +73,53 @@ std::string jsonCompactPrint(Json const& _input);
 /// Serialise the JSON object (@a _input) using specified format (@a _format)
 std::string jsonPrint(Json const& _input, JsonFormat const& _format);
 
+/**
+ * Writes a JSON document to a stream piece by piece, in the same format as @a jsonPrint, so that
+ * large documents do not have to be held in memory as a whole.
+ * Members are written in the order of the calls. To get the output of @a jsonPrint, they have to
+ * be written in lexicographical order of their names.
+ */
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& _stream, JsonFormat const& _format): m_stream(_stream), m_format(_format) {}
+
+	void beginObject();
+	void endObject();
+	void beginArray();
+	void endArray();
+	/// Starts a member of the current object, has to be followed by its value.
+	void key(std::string const& _name);
+	/// Writes a complete value, i.e. an array element, a member value or the whole document.
+	/// Nothing is written if the value cannot be serialized.
+	void value(Json const& _value);
+	/// Ends the objects and arrays until only @a _depth of them are open. Writes null as value of a
+	/// member whose name was already written.
+	void close(size_t _depth);
+
+	/// @returns the number of objects and arrays that are open.
+	size_t depth() const { return m_levels.size(); }
+
+private:
+	struct Level
+	{
+		bool isObject = false;
+		bool empty = true;
+	};
+
+	/// Writes the separator and the indentation in front of an array element or a member name.
+	void beginElement();
+	void beginValue();
+	void end(bool _isObject);
+	std::string indentation(size_t _depth) const;
+	bool pretty() const { return m_format.format == JsonFormat::Pretty; }
+
+	std::ostream& m_stream;
+	JsonFormat m_format;
+	std::vector<Level> m_levels;
+	bool m_expectingValue = false;
+};
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
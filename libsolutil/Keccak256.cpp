@@ -22,6 +22,7 @@
 
 #include <libsolutil/Keccak256.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 
@@ -180,4 +181,36 @@ h256 keccak256(bytesConstRef _input)
 	return output;
 }
 
+void Keccak256Hasher::update(bytesConstRef _input)
+{
+	uint8_t const* input = _input.data();
+	size_t length = _input.size();
+	while (length > 0)
+	{
+		size_t chunk = std::min(length, rate - m_offset);
+		xorin(m_state + m_offset, input, chunk);
+		input += chunk;
+		length -= chunk;
+		m_offset += chunk;
+		if (m_offset == rate)
+		{
+			P(m_state);
+			m_offset = 0;
+		}
+	}
+}
+
+h256 Keccak256Hasher::hash() const
+{
+	uint8_t state[Plen];
+	std::memcpy(state, m_state, Plen);
+	// Same padding as in the one-shot version above.
+	state[m_offset] ^= 0x01;
+	state[rate - 1] ^= 0x80;
+	P(state);
+	h256 output;
+	setout(state, output.data(), output.size);
+	return output;
+}
+
 }
@@ -26,7 +26,9 @@
 
 #include <libsolutil/FixedHash.h>
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace solidity::util
 {
@@ -43,4 +45,26 @@ inline h256 keccak256(std::string const& _input) { return keccak256(bytesConstRe
 /// Calculate Keccak-256 hash of the given input (presented as a FixedHash), returns a 256-bit hash.
 template<unsigned N> inline h256 keccak256(FixedHash<N> const& _input) { return keccak256(_input.ref()); }
 
+/// Keccak-256 hash of data that is fed in several steps.
+/// The result is equal to the hash of the concatenation of all the data.
+class Keccak256Hasher
+{
+public:
+	void update(bytesConstRef _input);
+	void update(std::string_view _input)
+	{
+		update(bytesConstRef(reinterpret_cast<uint8_t const*>(_input.data()), _input.size()));
+	}
+
+	/// @returns the hash of the data fed in so far. More data can be added afterwards.
+	h256 hash() const;
+
+private:
+	static size_t constexpr rate = 200 - (256 / 4);
+
+	uint8_t m_state[200] = {0};
+	/// Number of bytes absorbed into the current block of the state.
+	size_t m_offset = 0;
+};
+
 }
@@ -20,6 +20,8 @@
 
 #include <libsolutil/Common.h>
 
+#include <optional>
+
 namespace solidity::util
 {
 
@@ -56,4 +58,25 @@ inline bytes lebEncodeSigned(int64_t _n)
 	return result;
 }
 
+/// Decodes an unsigned LEB128 value starting at @a _offset in @a _data and moves @a _offset
+/// past it.
+/// @returns nullopt if the data ends within the value or if it does not fit into 64 bits.
+inline std::optional<uint64_t> lebDecode(bytesConstRef _data, size_t& _offset)
+{
+	uint64_t result = 0;
+	for (unsigned shift = 0; shift < 64; shift += 7)
+	{
+		if (_offset >= _data.size())
+			return std::nullopt;
+		uint8_t const byte = _data[_offset++];
+		uint64_t const bits = byte & 0x7f;
+		if (shift == 63 && bits > 1)
+			return std::nullopt;
+		result |= bits << shift;
+		if (!(byte & 0x80))
+			return result;
+	}
+	return std::nullopt;
+}
+
 }
@@ -21,7 +21,9 @@
 #include <libsolutil/Assertions.h>
 #include <libsolutil/Exceptions.h>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -31,9 +33,19 @@ namespace solidity::util
 
 DEV_SIMPLE_EXCEPTION(BadLazyInitAccess);
 
+/// Mutex held while initializing a LazyInit value. Other lazily computed caches of data that
+/// is accessed from several threads can use it as well. As a single recursive mutex, it allows
+/// initializers to depend on other lazily initialized values without risking a deadlock.
+inline std::recursive_mutex& lazyInitMutex()
+{
+	static std::recursive_mutex mutex;
+	return mutex;
+}
+
 /**
  * A value that is initialized at some point after construction of the LazyInit. The stored value can only be accessed
  * while calling "init", which initializes the stored value (if it has not already been initialized).
+ * Concurrent calls to "init" are safe, the value is initialized exactly once.
  *
  * @tparam T the type of the stored value; may not be a function, reference, array, or void type; may be const-qualified.
  */
@@ -53,16 +65,21 @@ public:
 	LazyInit& operator=(LazyInit const&) = delete;
 
 	// Move constructor must be overridden to ensure that moved-from object is left empty.
-	constexpr LazyInit(LazyInit&& _other) noexcept:
-		m_value(std::move(_other.m_value))
+	LazyInit(LazyInit&& _other) noexcept:
+		m_value(std::move(_other.m_value)),
+		m_initialized(_other.m_initialized.load())
 	{
 		_other.m_value.reset();
+		_other.m_initialized = false;
 	}
 
 	LazyInit& operator=(LazyInit&& _other) noexcept
 	{
 		this->m_value.swap(_other.m_value);
+		this->m_initialized = _other.m_initialized.load();
 		_other.m_value.reset();
+		_other.m_initialized = false;
+		return *this;
 	}
 
 	template<typename F>
@@ -85,11 +102,19 @@ private:
 	template<typename F>
 	void doInit(F&& _fun) const
 	{
+		if (m_initialized.load(std::memory_order_acquire))
+			return;
+		std::lock_guard lock(lazyInitMutex());
 		if (!m_value.has_value())
+		{
 			m_value.emplace(std::forward<F>(_fun)());
+			m_initialized.store(true, std::memory_order_release);
+		}
 	}
 
 	mutable std::optional<value_type> m_value;
+	/// Set after m_value has been initialized, allows checking that without taking the lock.
+	mutable std::atomic<bool> m_initialized = false;
 };
 
 }
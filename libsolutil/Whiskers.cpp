@@ -26,14 +26,78 @@
 
 #include <libsolutil/Assertions.h>
 
+#include <mutex>
 #include <regex>
+#include <set>
+#include <string_view>
+#include <unordered_map>
 
 using namespace solidity::util;
 
+/**
+ * Template parsed into a tree of text fragments, tags, lists and conditions.
+ * Rendering walks the tree once and appends to a single output string.
+ */
+class Whiskers::Template
+{
+public:
+	explicit Template(std::string _source);
+
+	std::string const& source() const { return m_source; }
+	/// @returns true if the template contains the string `"<" + _tag + ">"`.
+	bool containsTag(std::string const& _tag) const { return m_tags.count(_tag); }
+
+	void render(
+		std::string& _output,
+		StringMap const& _parameters,
+		std::map<std::string, bool> const& _conditions,
+		StringListMap const& _listParameters
+	) const;
+
+private:
+	struct Node
+	{
+		enum class Kind { Text, Tag, List, Condition };
+		Kind kind;
+		/// The text of a text node or the name of a tag, list or condition (including the "+" of
+		/// conditional value parameters).
+		std::string value;
+		std::vector<Node> body;
+		std::vector<Node> elseBody;
+	};
+
+	/// Parameters visible while rendering. Inside of a list, these are the parameters of the
+	/// current list element in addition to the outer ones.
+	struct Scope
+	{
+		StringMap const& parameters;
+		StringMap const* listElement;
+		std::map<std::string, bool> const& conditions;
+		/// Not available inside of lists.
+		StringListMap const* listParameters;
+
+		std::string const* findParameter(std::string const& _name) const;
+	};
+
+	static bool isNameChar(char _c);
+	/// @returns the length of the parameter name starting at @a _pos.
+	static size_t nameLength(std::string_view _text, size_t _pos);
+
+	/// Parses @a _text. Tags that are not closed are kept as text, like the
+	/// regular-expression-based implementation used to do.
+	std::vector<Node> parse(std::string_view _text) const;
+	void collectTags();
+	void render(std::string& _output, std::vector<Node> const& _nodes, Scope const& _scope) const;
+
+	std::string m_source;
+	std::vector<Node> m_nodes;
+	/// All strings `_tag` such that `"<" + _tag + ">"` occurs in the template.
+	std::set<std::string> m_tags;
+};
+
 Whiskers::Whiskers(std::string _template):
-	m_template(std::move(_template))
+	m_template(cachedTemplate(std::move(_template)))
 {
-	checkTemplateValid();
 }
 
 Whiskers& Whiskers::operator()(std::string _parameter, std::string _value)
@@ -71,25 +135,27 @@ Whiskers& Whiskers::operator()(
 
 std::string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
-}
-
-void Whiskers::checkTemplateValid() const
-{
-	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
-	std::smatch match;
-	assertThrow(
-		!regex_search(m_template, match, validTemplate),
-		WhiskersError,
-		"Template contains an invalid/unclosed tag " + match.str()
-	);
+	size_t size = m_template->source().size();
+	for (auto const& parameter: m_parameters)
+		size += parameter.second.size();
+	std::string result;
+	result.reserve(size);
+	m_template->render(result, m_parameters, m_conditions, m_listParameters);
+	return result;
 }
 
 void Whiskers::checkParameterValid(std::string const& _parameter) const
 {
-	static std::regex validParam("^" + paramRegex() + "$");
+	bool valid = !_parameter.empty();
+	for (char c: _parameter)
+		valid = valid && (
+			('a' <= c && c <= 'z') ||
+			('A' <= c && c <= 'Z') ||
+			('0' <= c && c <= '9') ||
+			c == '_' || c == '$' || c == '-'
+		);
 	assertThrow(
-		regex_match(_parameter, validParam),
+		valid,
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -117,127 +183,257 @@ void Whiskers::checkParameterUnknown(std::string const& _parameter) const
 void Whiskers::checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const
 {
 	for (auto const& prefix: _prefixes)
-	{
-		std::string tag{"<" + prefix + _parameter + ">"};
 		assertThrow(
-			m_template.find(tag) != std::string::npos,
+			m_template->containsTag(prefix + _parameter),
 			WhiskersError,
-			"Tag '" + tag + "' not found in template:\n" + m_template
+			"Tag '<" + prefix + _parameter + ">' not found in template:\n" + m_template->source()
 		);
-	}
 }
 
-namespace
+Whiskers::Template::Template(std::string _source):
+	m_source(std::move(_source))
 {
-template<class ReplaceCallback>
-std::string regex_replace(
-	std::string const& _source,
-	std::regex const& _pattern,
-	ReplaceCallback _replace,
-	std::regex_constants::match_flag_type _flags = std::regex_constants::match_default
-)
+	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
+	std::smatch match;
+	assertThrow(
+		!regex_search(m_source, match, validTemplate),
+		WhiskersError,
+		"Template contains an invalid/unclosed tag " + match.str()
+	);
+	m_nodes = parse(m_source);
+	collectTags();
+}
+
+void Whiskers::Template::render(
+	std::string& _output,
+	StringMap const& _parameters,
+	std::map<std::string, bool> const& _conditions,
+	StringListMap const& _listParameters
+) const
 {
-	std::sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	std::sregex_iterator matchEnd;
-	std::string::const_iterator lastMatchedPos(_source.cbegin());
-	std::string result;
-	while (curMatch != matchEnd)
+	render(_output, m_nodes, Scope{_parameters, nullptr, _conditions, &_listParameters});
+}
+
+std::string const* Whiskers::Template::Scope::findParameter(std::string const& _name) const
+{
+	if (listElement)
+		if (auto it = listElement->find(_name); it != listElement->end())
+			return &it->second;
+	if (auto it = parameters.find(_name); it != parameters.end())
+		return &it->second;
+	return nullptr;
+}
+
+bool Whiskers::Template::isNameChar(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+size_t Whiskers::Template::nameLength(std::string_view _text, size_t _pos)
+{
+	size_t length = 0;
+	while (_pos + length < _text.size() && isNameChar(_text[_pos + length]))
+		++length;
+	return length;
+}
+
+std::vector<Whiskers::Template::Node> Whiskers::Template::parse(std::string_view _text) const
+{
+	std::vector<Node> nodes;
+	auto appendText = [&](std::string_view _fragment) {
+		if (_fragment.empty())
+			return;
+		if (nodes.empty() || nodes.back().kind != Node::Kind::Text)
+			nodes.emplace_back(Node{Node::Kind::Text, {}, {}, {}});
+		nodes.back().value += _fragment;
+	};
+
+	size_t pos = 0;
+	while (pos < _text.size())
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
+		size_t const open = _text.find('<', pos);
+		if (open == std::string_view::npos)
+		{
+			appendText(_text.substr(pos));
+			break;
+		}
+		appendText(_text.substr(pos, open - pos));
+		pos = open + 1;
+		if (pos >= _text.size())
+		{
+			appendText("<");
+			break;
+		}
+
+		// <name>
+		if (size_t length = nameLength(_text, pos); length > 0)
+		{
+			if (pos + length < _text.size() && _text[pos + length] == '>')
+			{
+				nodes.emplace_back(Node{Node::Kind::Tag, std::string(_text.substr(pos, length)), {}, {}});
+				pos += length + 1;
+			}
+			else
+				appendText("<");
+			continue;
+		}
+
+		// <#name>...</name> and <?name>...<!name>...</name>, the body ends at the first closing tag.
+		char const kind = _text[pos];
+		if (kind != '#' && kind != '?')
+		{
+			appendText("<");
+			continue;
+		}
+		size_t nameStart = pos + 1;
+		if (kind == '?' && nameStart < _text.size() && _text[nameStart] == '+')
+			++nameStart;
+		size_t const length = nameLength(_text, nameStart);
+		if (length == 0 || nameStart + length >= _text.size() || _text[nameStart + length] != '>')
+		{
+			appendText("<");
+			continue;
+		}
+		std::string name(_text.substr(pos + 1, nameStart + length - pos - 1));
+		size_t const bodyStart = nameStart + length + 1;
+		std::string const closingTag = "</" + name + ">";
+		size_t const close = _text.find(closingTag, bodyStart);
+		if (close == std::string_view::npos)
+		{
+			appendText("<");
+			continue;
+		}
+
+		if (kind == '#')
+			nodes.emplace_back(Node{Node::Kind::List, std::move(name), parse(_text.substr(bodyStart, close - bodyStart)), {}});
+		else
+		{
+			size_t const elseTag = _text.find("<!" + name + ">", bodyStart);
+			if (elseTag != std::string_view::npos && elseTag < close)
+			{
+				size_t const elseStart = elseTag + name.size() + 3;
+				nodes.emplace_back(Node{
+					Node::Kind::Condition,
+					std::move(name),
+					parse(_text.substr(bodyStart, elseTag - bodyStart)),
+					parse(_text.substr(elseStart, close - elseStart))
+				});
+			}
+			else
+				nodes.emplace_back(Node{
+					Node::Kind::Condition,
+					std::move(name),
+					parse(_text.substr(bodyStart, close - bodyStart)),
+					{}
+				});
+		}
+		pos = close + closingTag.size();
 	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
+	return nodes;
 }
 
-std::string Whiskers::replace(
-	std::string const& _template,
-	StringMap const& _parameters,
-	std::map<std::string, bool> const& _conditions,
-	std::map<std::string, std::vector<StringMap>> const& _listParameters
-)
+void Whiskers::Template::collectTags()
 {
-	static std::regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](std::match_results<std::string::const_iterator> _match) -> std::string
+	for (size_t pos = m_source.find('<'); pos != std::string::npos; pos = m_source.find('<', pos + 1))
 	{
-		std::string tagName(_match[1]);
-		std::string listName(_match[2]);
-		std::string conditionName(_match[4]);
-		if (!tagName.empty())
+		size_t nameStart = pos + 1;
+		if (nameStart < m_source.size() && (m_source[nameStart] == '#' || m_source[nameStart] == '?' || m_source[nameStart] == '/'))
+			++nameStart;
+		size_t const length = nameLength(m_source, nameStart);
+		if (length > 0 && nameStart + length < m_source.size() && m_source[nameStart + length] == '>')
+			m_tags.emplace(m_source.substr(pos + 1, nameStart + length - pos - 1));
+	}
+}
+
+void Whiskers::Template::render(std::string& _output, std::vector<Node> const& _nodes, Scope const& _scope) const
+{
+	for (Node const& node: _nodes)
+		switch (node.kind)
+		{
+		case Node::Kind::Text:
+			_output += node.value;
+			break;
+		case Node::Kind::Tag:
 		{
+			std::string const* value = _scope.findParameter(node.value);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + node.value + " not provided.\n" +
 				"Template:\n" +
-				_template
+				m_source
 			);
-			return _parameters.at(tagName);
+			_output += *value;
+			break;
 		}
-		else if (!listName.empty())
+		case Node::Kind::List:
 		{
-			std::string templ(_match[3]);
+			auto list = _scope.listParameters ? _scope.listParameters->find(node.value) : StringListMap::const_iterator{};
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				_scope.listParameters && list != _scope.listParameters->end(),
+				WhiskersError, "List parameter " + node.value + " not set."
 			);
-			std::string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			for (auto const& element: list->second)
+			{
+				for (auto const& parameter: element)
+					assertThrow(
+						!_scope.findParameter(parameter.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				render(_output, node.body, Scope{_scope.parameters, &element, _scope.conditions, nullptr});
+			}
+			break;
 		}
-		else
+		case Node::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
 			bool conditionValue = false;
-			if (conditionName[0] == '+')
+			if (node.value[0] == '+')
 			{
-				std::string tag = conditionName.substr(1);
+				std::string tag = node.value.substr(1);
 
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
+				if (std::string const* value = _scope.findParameter(tag))
+					conditionValue = !value->empty();
+				else if (_scope.listParameters && _scope.listParameters->count(tag))
+					conditionValue = !_scope.listParameters->at(tag).empty();
 				else
 					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
 			}
 			else
 			{
 				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
+					_scope.conditions.count(node.value),
+					WhiskersError, "Condition parameter " + node.value + " not set."
 				);
-				conditionValue = _conditions.at(conditionName);
+				conditionValue = _scope.conditions.at(node.value);
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
+			render(_output, conditionValue ? node.body : node.elseBody, _scope);
+			break;
+		}
 		}
-	});
 }
 
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
+std::shared_ptr<Whiskers::Template const> Whiskers::cachedTemplate(std::string _template)
 {
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
-}
+	// Templates are almost always string literals, but some are assembled at runtime.
+	// Bound the cache so that those cannot make it grow without limit.
+	static size_t constexpr maxCacheSize = 1 << 14;
+	static std::mutex mutex;
+	static std::unordered_map<std::string, std::shared_ptr<Template const>> cache;
 
+	{
+		std::lock_guard lock(mutex);
+		if (auto it = cache.find(_template); it != cache.end())
+			return it->second;
+	}
+	// Parse outside of the lock, invalid templates throw and are not cached.
+	auto parsed = std::make_shared<Template const>(_template);
+	std::lock_guard lock(mutex);
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	return cache.emplace(std::move(_template), std::move(parsed)).first->second;
+}
@@ -25,6 +25,7 @@
 #include <libyul/AsmJsonConverter.h>
 #include <libyul/AST.h>
 #include <libyul/Exceptions.h>
+#include <libyul/optimiser/BlockHasher.h>
 
 #include <libsolutil/CommonData.h>
 #include <libsolutil/StringUtils.h>
@@ -200,6 +201,29 @@ std::vector<evmasm::SubAssemblyID> Object::pathToSubObject(std::string_view _qua
 	return path;
 }
 
+void Object::addSubObject(std::shared_ptr<ObjectNode> _subObject)
+{
+	yulAssert(_subObject);
+	yulAssert(!subIndexByName.count(_subObject->name), "Duplicate sub-object \"" + _subObject->name + "\".");
+	subIndexByName[_subObject->name] = subObjects.size();
+	subObjects.emplace_back(std::move(_subObject));
+}
+
+std::shared_ptr<Object> Object::copyTree() const
+{
+	auto copy = std::make_shared<Object>();
+	copy->name = name;
+	copy->debugData = debugData;
+	copy->setCode(m_code);
+	copy->m_codeHash = m_codeHash;
+	for (std::shared_ptr<ObjectNode> const& subNode: subObjects)
+		if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+			copy->addSubObject(subObject->copyTree());
+		else
+			copy->addSubObject(subNode);
+	return copy;
+}
+
 std::shared_ptr<AST const> Object::code() const
 {
 	return m_code;
@@ -210,9 +234,18 @@ bool Object::hasCode() const { return code() != nullptr; }
 void Object::setCode(std::shared_ptr<AST const> const& _ast, std::shared_ptr<yul::AsmAnalysisInfo> _analysisInfo)
 {
 	m_code = _ast;
+	m_codeHash.reset();
 	analysisInfo = std::move(_analysisInfo);
 }
 
+h256 Object::codeHash() const
+{
+	yulAssert(hasCode());
+	if (!m_codeHash)
+		m_codeHash = StructuralHasher::run(m_code->root());
+	return *m_codeHash;
+}
+
 void Object::collectSourceIndices(std::map<std::string, unsigned>& _indices) const
 {
 	if (debugData && debugData->sourceNames.has_value())
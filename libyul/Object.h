@@ -30,9 +30,11 @@
 #include <liblangutil/DebugInfoSelection.h>
 
 #include <libsolutil/Common.h>
+#include <libsolutil/FixedHash.h>
 #include <libsolutil/JSON.h>
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <limits>
 
@@ -139,9 +141,19 @@ public:
 	/// The path must not lead to a @a Data object (will throw in that case).
 	std::vector<evmasm::SubAssemblyID> pathToSubObject(std::string_view _qualifiedName) const;
 
+	/// Appends @a _subObject to the sub-objects and makes it accessible by its name.
+	void addSubObject(std::shared_ptr<ObjectNode> _subObject);
+
+	/// @returns a copy of this object and all its sub-objects that shares the code and the data
+	/// with the original, but not the analysis results or the sub ids.
+	std::shared_ptr<Object> copyTree() const;
+
 	std::shared_ptr<AST const> code() const;
 	void setCode(std::shared_ptr<AST const> const& _ast, std::shared_ptr<yul::AsmAnalysisInfo> = nullptr);
 	bool hasCode() const;
+	/// @returns a structural hash of the code, which is computed on first use and kept until
+	/// the code is replaced. Does not cover sub-objects.
+	util::h256 codeHash() const;
 
 	/// sub id for object if it is subobject of another object, max value / empty if it is not subobject
 	evmasm::SubAssemblyID subId{};
@@ -167,6 +179,7 @@ public:
 
 private:
 	std::shared_ptr<AST const> m_code;
+	mutable std::optional<util::h256> m_codeHash;
 };
 
 }
@@ -20,7 +20,6 @@
 
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmAnalysis.h>
-#include <libyul/AsmPrinter.h>
 #include <libyul/AST.h>
 #include <libyul/Exceptions.h>
 #include <libyul/backends/evm/EVMDialect.h>
@@ -28,7 +27,6 @@
 #include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/Suite.h>
 
-#include <liblangutil/DebugInfoSelection.h>
 
 #include <libsolutil/Keccak256.h>
 
@@ -82,7 +80,7 @@ void ObjectOptimizer::optimize(Object& _object, Settings const& _settings, bool
 	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&dialect))
 		meter = std::make_unique<GasMeter>(*evmDialect, _isCreation, _settings.expectedExecutionsPerDeployment);
 
-	std::optional<h256> cacheKey = calculateCacheKey(_object.code()->root(), *_object.debugData, _settings, _isCreation);
+	std::optional<h256> cacheKey = calculateCacheKey(_object, _settings, _isCreation);
 	if (cacheKey.has_value() && m_cachedObjects.count(*cacheKey) != 0)
 	{
 		overwriteWithOptimizedObject(*cacheKey, _object);
@@ -96,7 +94,9 @@ void ObjectOptimizer::optimize(Object& _object, Settings const& _settings, bool
 		_settings.yulOptimiserSteps,
 		_settings.yulOptimiserCleanupSteps,
 		_isCreation ? std::nullopt : std::make_optional(_settings.expectedExecutionsPerDeployment),
-		{}
+		_settings.expectedExecutionsPerDeployment,
+		{},
+		_settings.executionProfile
 	);
 
 	if (cacheKey.has_value())
@@ -134,25 +134,20 @@ void ObjectOptimizer::overwriteWithOptimizedObject(util::h256 _cacheKey, Object&
 }
 
 std::optional<h256> ObjectOptimizer::calculateCacheKey(
-	Block const& _ast,
-	ObjectDebugData const& _debugData,
+	Object const& _object,
 	Settings const& _settings,
 	bool _isCreation
 )
 {
-	AsmPrinter asmPrinter(
-		languageToDialect(_settings.language, _settings.evmVersion, _settings.eofVersion),
-		_debugData.sourceNames,
-		DebugInfoSelection::All()
-	);
+	yulAssert(_object.debugData);
 
 	bytes rawKey;
-	// NOTE: AsmPrinter never prints nativeLocations included in debug data, so ASTs differing only
+	// NOTE: The structural hash does not include nativeLocations from debug data, so ASTs differing only
 	// in that regard are considered equal here.  This is fine because the optimizer does not keep
 	// them up to date across AST transformations anyway so in any use where they need to be reliable,
 	// we just regenerate them by reparsing the object.
-	rawKey += keccak256(asmPrinter(_ast)).asBytes();
-	rawKey += keccak256(_debugData.formatUseSrcComment()).asBytes();
+	rawKey += _object.codeHash().asBytes();
+	rawKey += keccak256(_object.debugData->formatUseSrcComment()).asBytes();
 	rawKey += h256(u256(_settings.language)).asBytes();
 	static_assert(static_cast<uint8_t>(static_cast<bool>(2)) == 1);
 	rawKey += FixedHash<1>(static_cast<uint8_t>(_settings.optimizeStackAllocation)).asBytes();
@@ -163,6 +158,8 @@ std::optional<h256> ObjectOptimizer::calculateCacheKey(
 	rawKey += FixedHash<1>(static_cast<uint8_t>(_settings.eofVersion ? *_settings.eofVersion : 0)).asBytes();
 	rawKey += keccak256(_settings.yulOptimiserSteps).asBytes();
 	rawKey += keccak256(_settings.yulOptimiserCleanupSteps).asBytes();
+	if (_settings.executionProfile)
+		rawKey += keccak256(_settings.executionProfile->toJson().dump()).asBytes();
 
 	return h256(keccak256(rawKey));
 }
@@ -22,6 +22,7 @@
 #include <libyul/Object.h>
 
 #include <liblangutil/EVMVersion.h>
+#include <liblangutil/ExecutionProfile.h>
 
 #include <libsolutil/FixedHash.h>
 
@@ -63,6 +64,9 @@ public:
 		std::string yulOptimiserSteps;
 		std::string yulOptimiserCleanupSteps;
 		size_t expectedExecutionsPerDeployment;
+		/// Optional execution counts used to weight the expected executions of individual
+		/// pieces of code. Has to outlive the optimization.
+		langutil::ExecutionProfile const* executionProfile;
 	};
 
 	/// Recursively optimizes a Yul object with given settings, reusing cached ASTs where possible
@@ -86,8 +90,7 @@ private:
 	void overwriteWithOptimizedObject(util::h256 _cacheKey, Object& _object) const;
 
 	static std::optional<util::h256> calculateCacheKey(
-		Block const& _ast,
-		ObjectDebugData const& _debugData,
+		Object const& _object,
 		Settings const& _settings,
 		bool _isCreation
 	);
@@ -0,0 +1,784 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/ObjectSerializer.h>
+
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AST.h>
+#include <libyul/Dialect.h>
+#include <libyul/Object.h>
+#include <libyul/ScopeFiller.h>
+
+#include <liblangutil/ErrorReporter.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/LEB128.h>
+#include <libsolutil/Numeric.h>
+#include <libsolutil/Visitor.h>
+
+#include <array>
+#include <limits>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+namespace
+{
+
+std::array<uint8_t, 3> constexpr magic{'y', 'u', 'l'};
+
+enum class ObjectKind: uint8_t { Object, Data };
+
+enum class NodeKind: uint8_t
+{
+	FunctionCall,
+	Identifier,
+	Literal,
+	ExpressionStatement,
+	Assignment,
+	VariableDeclaration,
+	FunctionDefinition,
+	If,
+	Switch,
+	ForLoop,
+	Break,
+	Continue,
+	Leave,
+	Block
+};
+
+enum class FunctionNameKind: uint8_t { Identifier, Builtin };
+
+/// Flags of literals.
+uint8_t constexpr literalUnlimited = 1;
+uint8_t constexpr literalHasHint = 2;
+
+/// Values describing the debug data of an object.
+uint8_t constexpr objectWithoutDebugData = 0;
+uint8_t constexpr objectWithoutSourceNames = 1;
+uint8_t constexpr objectWithSourceNames = 2;
+
+class Writer
+{
+public:
+	explicit Writer(Dialect const& _dialect): m_dialect(_dialect) {}
+
+	bytes run(Object const& _object)
+	{
+		writeObject(_object);
+
+		bytes result(magic.begin(), magic.end());
+		result.emplace_back(ObjectSerializer::formatVersion);
+		append(result, m_stringList.size());
+		for (std::string const* string: m_stringList)
+		{
+			append(result, string->size());
+			result += asBytes(*string);
+		}
+		append(result, m_numDebugData);
+		result += m_debugData;
+		result += m_nodes;
+		return result;
+	}
+
+	void writeObject(Object const& _object)
+	{
+		writeNumber(static_cast<uint8_t>(ObjectKind::Object));
+		writeString(_object.name);
+		if (!_object.debugData)
+			writeNumber(objectWithoutDebugData);
+		else if (!_object.debugData->sourceNames)
+			writeNumber(objectWithoutSourceNames);
+		else
+		{
+			writeNumber(objectWithSourceNames);
+			writeNumber(_object.debugData->sourceNames->size());
+			for (auto const& [index, name]: *_object.debugData->sourceNames)
+			{
+				writeNumber(index);
+				writeString(*name);
+			}
+		}
+		yulAssert(_object.hasCode());
+		(*this)(_object.code()->root());
+
+		writeNumber(_object.subObjects.size());
+		for (std::shared_ptr<ObjectNode> const& subNode: _object.subObjects)
+			if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+				writeObject(*subObject);
+			else
+			{
+				auto const* data = dynamic_cast<Data const*>(subNode.get());
+				yulAssert(data);
+				writeNumber(static_cast<uint8_t>(ObjectKind::Data));
+				writeString(data->name);
+				writeNumber(data->data.size());
+				m_nodes += data->data;
+			}
+	}
+
+	void operator()(Literal const& _literal)
+	{
+		writeNode(NodeKind::Literal, _literal.debugData);
+		writeNumber(static_cast<uint8_t>(_literal.kind));
+		uint8_t flags = 0;
+		if (_literal.value.unlimited())
+			flags |= literalUnlimited;
+		if (_literal.value.hint())
+			flags |= literalHasHint;
+		writeNumber(flags);
+		if (_literal.value.unlimited())
+			writeString(_literal.value.builtinStringLiteralValue());
+		else
+		{
+			bytes value = toCompactBigEndian(_literal.value.value());
+			writeNumber(value.size());
+			m_nodes += value;
+		}
+		if (_literal.value.hint())
+			writeString(*_literal.value.hint());
+	}
+
+	void operator()(Identifier const& _identifier)
+	{
+		writeNode(NodeKind::Identifier, _identifier.debugData);
+		writeString(_identifier.name.str());
+	}
+
+	void operator()(FunctionCall const& _funCall)
+	{
+		writeNode(NodeKind::FunctionCall, _funCall.debugData);
+		std::visit(GenericVisitor{
+			[&](BuiltinName const& _builtin)
+			{
+				writeNumber(static_cast<uint8_t>(FunctionNameKind::Builtin));
+				writeNumber(debugDataIndex(_builtin.debugData));
+				writeString(m_dialect.builtin(_builtin.handle).name);
+			},
+			[&](Identifier const& _identifier)
+			{
+				writeNumber(static_cast<uint8_t>(FunctionNameKind::Identifier));
+				writeNumber(debugDataIndex(_identifier.debugData));
+				writeString(_identifier.name.str());
+			}
+		}, _funCall.functionName);
+		writeNumber(_funCall.arguments.size());
+		for (Expression const& argument: _funCall.arguments)
+			std::visit(*this, argument);
+	}
+
+	void operator()(ExpressionStatement const& _statement)
+	{
+		writeNode(NodeKind::ExpressionStatement, _statement.debugData);
+		std::visit(*this, _statement.expression);
+	}
+
+	void operator()(Assignment const& _assignment)
+	{
+		writeNode(NodeKind::Assignment, _assignment.debugData);
+		writeNumber(_assignment.variableNames.size());
+		for (Identifier const& variable: _assignment.variableNames)
+		{
+			writeNumber(debugDataIndex(variable.debugData));
+			writeString(variable.name.str());
+		}
+		yulAssert(_assignment.value);
+		std::visit(*this, *_assignment.value);
+	}
+
+	void operator()(VariableDeclaration const& _varDecl)
+	{
+		writeNode(NodeKind::VariableDeclaration, _varDecl.debugData);
+		writeNames(_varDecl.variables);
+		writeNumber(_varDecl.value != nullptr);
+		if (_varDecl.value)
+			std::visit(*this, *_varDecl.value);
+	}
+
+	void operator()(FunctionDefinition const& _funDef)
+	{
+		writeNode(NodeKind::FunctionDefinition, _funDef.debugData);
+		writeString(_funDef.name.str());
+		writeNames(_funDef.parameters);
+		writeNames(_funDef.returnVariables);
+		(*this)(_funDef.body);
+	}
+
+	void operator()(If const& _if)
+	{
+		writeNode(NodeKind::If, _if.debugData);
+		std::visit(*this, *_if.condition);
+		(*this)(_if.body);
+	}
+
+	void operator()(Switch const& _switch)
+	{
+		writeNode(NodeKind::Switch, _switch.debugData);
+		std::visit(*this, *_switch.expression);
+		writeNumber(_switch.cases.size());
+		for (Case const& switchCase: _switch.cases)
+		{
+			writeNumber(debugDataIndex(switchCase.debugData));
+			writeNumber(switchCase.value != nullptr);
+			if (switchCase.value)
+				(*this)(*switchCase.value);
+			(*this)(switchCase.body);
+		}
+	}
+
+	void operator()(ForLoop const& _loop)
+	{
+		writeNode(NodeKind::ForLoop, _loop.debugData);
+		(*this)(_loop.pre);
+		std::visit(*this, *_loop.condition);
+		(*this)(_loop.post);
+		(*this)(_loop.body);
+	}
+
+	void operator()(Break const& _break) { writeNode(NodeKind::Break, _break.debugData); }
+	void operator()(Continue const& _continue) { writeNode(NodeKind::Continue, _continue.debugData); }
+	void operator()(Leave const& _leave) { writeNode(NodeKind::Leave, _leave.debugData); }
+
+	void operator()(Block const& _block)
+	{
+		writeNode(NodeKind::Block, _block.debugData);
+		writeNumber(_block.statements.size());
+		for (Statement const& statement: _block.statements)
+			std::visit(*this, statement);
+	}
+
+private:
+	void writeNames(NameWithDebugDataList const& _names)
+	{
+		writeNumber(_names.size());
+		for (NameWithDebugData const& name: _names)
+		{
+			writeNumber(debugDataIndex(name.debugData));
+			writeString(name.name.str());
+		}
+	}
+
+	void writeNode(NodeKind _kind, DebugData::ConstPtr const& _debugData)
+	{
+		writeNumber(static_cast<uint8_t>(_kind));
+		writeNumber(debugDataIndex(_debugData));
+	}
+
+	void writeNumber(uint64_t _value) { append(m_nodes, _value); }
+
+	void writeString(std::string const& _string)
+	{
+		writeNumber(stringIndex(_string));
+	}
+
+	/// @returns the index of @a _debugData in the debug data table, where 0 stands for no debug data.
+	size_t debugDataIndex(DebugData::ConstPtr const& _debugData)
+	{
+		if (!_debugData)
+			return 0;
+		auto [it, inserted] = m_debugDataIndices.try_emplace(_debugData.get(), m_numDebugData + 1);
+		if (inserted)
+		{
+			++m_numDebugData;
+			appendLocation(_debugData->nativeLocation);
+			appendLocation(_debugData->originLocation);
+			append(m_debugData, _debugData->astID.has_value());
+			if (_debugData->astID)
+				append(m_debugData, static_cast<uint64_t>(*_debugData->astID));
+		}
+		return it->second;
+	}
+
+	void appendLocation(SourceLocation const& _location)
+	{
+		// Source offsets are -1 if unknown, store them shifted by one.
+		append(m_debugData, static_cast<uint64_t>(static_cast<int64_t>(_location.start) + 1));
+		append(m_debugData, static_cast<uint64_t>(static_cast<int64_t>(_location.end) + 1));
+		append(m_debugData, _location.sourceName ? stringIndex(*_location.sourceName) + 1 : 0);
+	}
+
+	size_t stringIndex(std::string const& _string)
+	{
+		auto [it, inserted] = m_stringIndices.try_emplace(_string, m_stringList.size());
+		if (inserted)
+			m_stringList.emplace_back(&it->first);
+		return it->second;
+	}
+
+	static void append(bytes& _target, uint64_t _value)
+	{
+		if (_value < 0x80)
+			_target.emplace_back(static_cast<uint8_t>(_value));
+		else
+			_target += lebEncode(_value);
+	}
+
+	Dialect const& m_dialect;
+	std::map<std::string, size_t> m_stringIndices;
+	std::vector<std::string const*> m_stringList;
+	std::map<DebugData const*, size_t> m_debugDataIndices;
+	size_t m_numDebugData = 0;
+	bytes m_debugData;
+	bytes m_nodes;
+};
+
+class Reader
+{
+public:
+	Reader(bytesConstRef _data, Dialect const& _dialect): m_data(_data), m_dialect(_dialect) {}
+
+	std::shared_ptr<Object> run()
+	{
+		for (uint8_t expected: magic)
+			if (readByte() != expected)
+				fail("Not a serialized Yul object.");
+		if (readByte() != ObjectSerializer::formatVersion)
+			fail("Unsupported format version.");
+
+		size_t const numStrings = readSize();
+		m_strings.reserve(numStrings);
+		for (size_t i = 0; i < numStrings; ++i)
+		{
+			bytesConstRef string = readBytes(readSize());
+			m_strings.emplace_back(reinterpret_cast<char const*>(string.data()), string.size());
+		}
+		m_names.resize(numStrings);
+		m_sharedStrings.resize(numStrings);
+
+		size_t const numDebugData = readSize();
+		m_debugData.reserve(numDebugData + 1);
+		m_debugData.emplace_back(nullptr);
+		for (size_t i = 0; i < numDebugData; ++i)
+		{
+			SourceLocation nativeLocation = readLocation();
+			SourceLocation originLocation = readLocation();
+			std::optional<int64_t> astID;
+			if (readFlag())
+				astID = static_cast<int64_t>(readNumber());
+			m_debugData.emplace_back(DebugData::create(std::move(nativeLocation), std::move(originLocation), astID));
+		}
+
+		if (readByte() != static_cast<uint8_t>(ObjectKind::Object))
+			fail("Expected an object.");
+		std::shared_ptr<Object> object = readObject();
+		if (m_offset != m_data.size())
+			fail("Unexpected data after the object.");
+		return object;
+	}
+
+private:
+	std::shared_ptr<Object> readObject()
+	{
+		RecursionGuard guard(*this);
+		auto object = std::make_shared<Object>();
+		object->name = readString();
+		switch (readByte())
+		{
+		case objectWithoutDebugData:
+			break;
+		case objectWithoutSourceNames:
+			object->debugData = std::make_shared<ObjectDebugData>();
+			break;
+		case objectWithSourceNames:
+		{
+			SourceNameMap sourceNames;
+			size_t const numSourceNames = readSize();
+			for (size_t i = 0; i < numSourceNames; ++i)
+			{
+				uint64_t const index = readNumber();
+				if (index > std::numeric_limits<unsigned>::max())
+					fail("Invalid source index.");
+				sourceNames[static_cast<unsigned>(index)] = readSharedString();
+			}
+			object->debugData = std::make_shared<ObjectDebugData>(ObjectDebugData{std::move(sourceNames)});
+			break;
+		}
+		default:
+			fail("Invalid object debug data.");
+		}
+
+		auto code = std::make_shared<AST>(m_dialect, readBlock());
+		auto analysisInfo = std::make_shared<AsmAnalysisInfo>();
+		ErrorList errors;
+		ErrorReporter errorReporter(errors);
+		if (!ScopeFiller(*analysisInfo, errorReporter)(code->root()))
+			fail("Invalid scopes in the code of object \"" + object->name + "\".");
+		object->setCode(std::move(code), std::move(analysisInfo));
+
+		size_t const numSubObjects = readSize();
+		for (size_t i = 0; i < numSubObjects; ++i)
+		{
+			std::shared_ptr<ObjectNode> subNode;
+			switch (readByte())
+			{
+			case static_cast<uint8_t>(ObjectKind::Object):
+				subNode = readObject();
+				break;
+			case static_cast<uint8_t>(ObjectKind::Data):
+			{
+				std::string name = readString();
+				bytesConstRef data = readBytes(readSize());
+				subNode = std::make_shared<Data>(std::move(name), data.toBytes());
+				break;
+			}
+			default:
+				fail("Invalid sub-object kind.");
+			}
+			if (object->subIndexByName.count(subNode->name))
+				fail("Duplicate sub-object \"" + subNode->name + "\".");
+			object->addSubObject(std::move(subNode));
+		}
+		return object;
+	}
+
+	Expression readExpression()
+	{
+		RecursionGuard guard(*this);
+		switch (readNodeKind())
+		{
+		case NodeKind::FunctionCall:
+		{
+			FunctionCall call{readDebugData(), {}, {}};
+			auto const nameKind = readByte();
+			DebugData::ConstPtr nameDebugData = readDebugData();
+			if (nameKind == static_cast<uint8_t>(FunctionNameKind::Builtin))
+			{
+				std::string const& name = m_strings.at(readStringIndex());
+				std::optional<BuiltinHandle> handle = m_dialect.findBuiltin(name);
+				if (!handle)
+					fail("Unknown builtin \"" + name + "\".");
+				call.functionName = BuiltinName{std::move(nameDebugData), *handle};
+			}
+			else if (nameKind == static_cast<uint8_t>(FunctionNameKind::Identifier))
+				call.functionName = Identifier{std::move(nameDebugData), readName()};
+			else
+				fail("Invalid function name.");
+			size_t const numArguments = readSize();
+			call.arguments.reserve(numArguments);
+			for (size_t i = 0; i < numArguments; ++i)
+				call.arguments.emplace_back(readExpression());
+			return call;
+		}
+		case NodeKind::Identifier:
+		{
+			DebugData::ConstPtr debugData = readDebugData();
+			return Identifier{std::move(debugData), readName()};
+		}
+		case NodeKind::Literal:
+			return readLiteralFields();
+		default:
+			fail("Expected an expression.");
+		}
+	}
+
+	Literal readLiteral()
+	{
+		expectNodeKind(NodeKind::Literal);
+		return readLiteralFields();
+	}
+
+	Literal readLiteralFields()
+	{
+		DebugData::ConstPtr debugData = readDebugData();
+		uint8_t const kind = readByte();
+		if (kind > static_cast<uint8_t>(LiteralKind::String))
+			fail("Invalid literal kind.");
+		uint8_t const flags = readByte();
+		if (flags & ~(literalUnlimited | literalHasHint))
+			fail("Invalid literal flags.");
+
+		LiteralValue value;
+		if (flags & literalUnlimited)
+		{
+			if (flags & literalHasHint)
+				fail("Unlimited literals cannot have a hint.");
+			value = LiteralValue(readString());
+		}
+		else
+		{
+			size_t const length = readSize();
+			if (length > 32)
+				fail("Literal value too large.");
+			u256 const number = fromBigEndian<u256>(readBytes(length));
+			value = (flags & literalHasHint) ? LiteralValue(number, readString()) : LiteralValue(number);
+		}
+		return Literal{std::move(debugData), static_cast<LiteralKind>(kind), std::move(value)};
+	}
+
+	Statement readStatement()
+	{
+		RecursionGuard guard(*this);
+		NodeKind const kind = readNodeKind();
+		if (kind == NodeKind::Block)
+			return readBlockFields();
+		DebugData::ConstPtr debugData = readDebugData();
+		switch (kind)
+		{
+		case NodeKind::ExpressionStatement:
+			return ExpressionStatement{std::move(debugData), readExpression()};
+		case NodeKind::Assignment:
+		{
+			Assignment assignment{std::move(debugData), {}, {}};
+			size_t const numVariables = readSize();
+			for (size_t i = 0; i < numVariables; ++i)
+			{
+				DebugData::ConstPtr variableDebugData = readDebugData();
+				assignment.variableNames.emplace_back(Identifier{std::move(variableDebugData), readName()});
+			}
+			assignment.value = std::make_unique<Expression>(readExpression());
+			return assignment;
+		}
+		case NodeKind::VariableDeclaration:
+		{
+			VariableDeclaration declaration{std::move(debugData), readNames(), {}};
+			if (readFlag())
+				declaration.value = std::make_unique<Expression>(readExpression());
+			return declaration;
+		}
+		case NodeKind::FunctionDefinition:
+		{
+			FunctionDefinition definition{std::move(debugData), readName(), {}, {}, {}};
+			definition.parameters = readNames();
+			definition.returnVariables = readNames();
+			definition.body = readBlock();
+			return definition;
+		}
+		case NodeKind::If:
+		{
+			If ifStatement{std::move(debugData), std::make_unique<Expression>(readExpression()), {}};
+			ifStatement.body = readBlock();
+			return ifStatement;
+		}
+		case NodeKind::Switch:
+		{
+			Switch switchStatement{std::move(debugData), std::make_unique<Expression>(readExpression()), {}};
+			size_t const numCases = readSize();
+			for (size_t i = 0; i < numCases; ++i)
+			{
+				Case switchCase{readDebugData(), {}, {}};
+				if (readFlag())
+					switchCase.value = std::make_unique<Literal>(readLiteral());
+				switchCase.body = readBlock();
+				switchStatement.cases.emplace_back(std::move(switchCase));
+			}
+			return switchStatement;
+		}
+		case NodeKind::ForLoop:
+		{
+			ForLoop loop{std::move(debugData), readBlock(), {}, {}, {}};
+			loop.condition = std::make_unique<Expression>(readExpression());
+			loop.post = readBlock();
+			loop.body = readBlock();
+			return loop;
+		}
+		case NodeKind::Break:
+			return Break{std::move(debugData)};
+		case NodeKind::Continue:
+			return Continue{std::move(debugData)};
+		case NodeKind::Leave:
+			return Leave{std::move(debugData)};
+		default:
+			fail("Expected a statement.");
+		}
+	}
+
+	Block readBlock()
+	{
+		RecursionGuard guard(*this);
+		expectNodeKind(NodeKind::Block);
+		return readBlockFields();
+	}
+
+	Block readBlockFields()
+	{
+		Block block{readDebugData(), {}};
+		size_t const numStatements = readSize();
+		block.statements.reserve(numStatements);
+		for (size_t i = 0; i < numStatements; ++i)
+			block.statements.emplace_back(readStatement());
+		return block;
+	}
+
+	NameWithDebugDataList readNames()
+	{
+		NameWithDebugDataList names;
+		size_t const numNames = readSize();
+		names.reserve(numNames);
+		for (size_t i = 0; i < numNames; ++i)
+		{
+			DebugData::ConstPtr debugData = readDebugData();
+			names.emplace_back(NameWithDebugData{std::move(debugData), readName()});
+		}
+		return names;
+	}
+
+	NodeKind readNodeKind()
+	{
+		uint8_t const kind = readByte();
+		if (kind > static_cast<uint8_t>(NodeKind::Block))
+			fail("Invalid node kind.");
+		return static_cast<NodeKind>(kind);
+	}
+
+	void expectNodeKind(NodeKind _kind)
+	{
+		if (readNodeKind() != _kind)
+			fail("Unexpected node kind.");
+	}
+
+	DebugData::ConstPtr readDebugData()
+	{
+		uint64_t const index = readNumber();
+		if (index >= m_debugData.size())
+			fail("Invalid debug data index.");
+		return m_debugData[static_cast<size_t>(index)];
+	}
+
+	SourceLocation readLocation()
+	{
+		SourceLocation location;
+		location.start = readOffset();
+		location.end = readOffset();
+		if (uint64_t const sourceName = readNumber())
+		{
+			if (sourceName > m_strings.size())
+				fail("Invalid string index.");
+			location.sourceName = readSharedString(static_cast<size_t>(sourceName - 1));
+		}
+		return location;
+	}
+
+	int readOffset()
+	{
+		uint64_t const offset = readNumber();
+		if (offset > static_cast<uint64_t>(std::numeric_limits<int>::max()) + 1)
+			fail("Invalid source offset.");
+		return static_cast<int>(static_cast<int64_t>(offset) - 1);
+	}
+
+	size_t readStringIndex()
+	{
+		uint64_t const index = readNumber();
+		if (index >= m_strings.size())
+			fail("Invalid string index.");
+		return static_cast<size_t>(index);
+	}
+
+	std::string readString() { return m_strings[readStringIndex()]; }
+
+	YulName readName()
+	{
+		size_t const index = readStringIndex();
+		if (!m_names[index])
+			m_names[index] = YulName{m_strings[index]};
+		return *m_names[index];
+	}
+
+	std::shared_ptr<std::string const> readSharedString() { return readSharedString(readStringIndex()); }
+
+	std::shared_ptr<std::string const> readSharedString(size_t _index)
+	{
+		if (!m_sharedStrings[_index])
+			m_sharedStrings[_index] = std::make_shared<std::string const>(m_strings[_index]);
+		return m_sharedStrings[_index];
+	}
+
+	bool readFlag()
+	{
+		uint8_t const flag = readByte();
+		if (flag > 1)
+			fail("Invalid flag.");
+		return flag == 1;
+	}
+
+	uint8_t readByte()
+	{
+		uint64_t const value = readNumber();
+		if (value > 0xff)
+			fail("Value out of range.");
+		return static_cast<uint8_t>(value);
+	}
+
+	/// Reads a number of elements. Each element takes at least one byte, which bounds the
+	/// allocations done for malformed input.
+	size_t readSize()
+	{
+		uint64_t const size = readNumber();
+		if (size > m_data.size() - m_offset)
+			fail("Invalid size.");
+		return static_cast<size_t>(size);
+	}
+
+	uint64_t readNumber()
+	{
+		std::optional<uint64_t> value = lebDecode(m_data, m_offset);
+		if (!value)
+			fail("Unexpected end of data.");
+		return *value;
+	}
+
+	bytesConstRef readBytes(size_t _length)
+	{
+		if (_length > m_data.size() - m_offset)
+			fail("Unexpected end of data.");
+		bytesConstRef result = m_data.cropped(m_offset, _length);
+		m_offset += _length;
+		return result;
+	}
+
+	[[noreturn]] void fail(std::string const& _message) const
+	{
+		solThrow(ObjectFormatError, _message);
+	}
+
+	/// Limits the nesting of the AST like the parser does.
+	struct RecursionGuard
+	{
+		explicit RecursionGuard(Reader& _reader): m_reader(_reader)
+		{
+			if (++m_reader.m_recursionDepth > 3000)
+				m_reader.fail("Maximum recursion depth reached.");
+		}
+		~RecursionGuard() { --m_reader.m_recursionDepth; }
+		Reader& m_reader;
+	};
+
+	bytesConstRef m_data;
+	size_t m_offset = 0;
+	Dialect const& m_dialect;
+	size_t m_recursionDepth = 0;
+	std::vector<std::string> m_strings;
+	std::vector<std::optional<YulName>> m_names;
+	std::vector<std::shared_ptr<std::string const>> m_sharedStrings;
+	std::vector<DebugData::ConstPtr> m_debugData;
+};
+
+}
+
+bytes ObjectSerializer::serialize(Object const& _object)
+{
+	yulAssert(_object.dialect());
+	return Writer(*_object.dialect()).run(_object);
+}
+
+std::shared_ptr<Object> ObjectSerializer::deserialize(bytesConstRef _data, Dialect const& _dialect)
+{
+	return Reader(_data, _dialect).run();
+}
@@ -0,0 +1,70 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compact binary format for Yul objects.
+ */
+
+#pragma once
+
+#include <libyul/Exceptions.h>
+
+#include <libsolutil/Common.h>
+
+#include <memory>
+
+namespace solidity::yul
+{
+
+class Dialect;
+class Object;
+
+struct ObjectFormatError: virtual YulException {};
+
+/**
+ * Converts Yul objects (including their sub-objects and data) to and from a compact binary
+ * format that is meant for caching objects and passing them between processes. It is much
+ * smaller and faster to read than the textual and the JSON representation.
+ *
+ * Layout, all numbers are unsigned LEB128:
+ *  - the magic bytes "yul" and the format version,
+ *  - a table of all strings (identifiers, builtin names, object and source names, string literals),
+ *  - a table of all distinct debug data, which AST nodes usually share,
+ *  - the object tree, where AST nodes are written in pre-order as a node kind followed by an index
+ *    into the debug data table and the fields of the node, with strings given as indices into
+ *    the string table.
+ *
+ * Builtins are stored by name, so the format does not depend on the order of the builtins of a
+ * dialect. The native locations of the debug data are included.
+ */
+class ObjectSerializer
+{
+public:
+	/// Version of the format. Data written with a different version is rejected.
+	static uint8_t constexpr formatVersion = 1;
+
+	static bytes serialize(Object const& _object);
+
+	/// Reconstructs an object from data produced by @a serialize in a single pass. The analysis
+	/// info of all objects is restored by registering the scopes of the code, the code is not
+	/// analyzed again.
+	/// @param _dialect dialect the object was written with, used to resolve the builtins.
+	/// @throws ObjectFormatError if @a _data is not a valid serialized object.
+	static std::shared_ptr<Object> deserialize(bytesConstRef _data, Dialect const& _dialect);
+};
+
+}
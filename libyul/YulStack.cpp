@@ -87,6 +87,19 @@ bool YulStack::parseAndAnalyze(std::string const& _sourceName, std::string const
 	return analyzeParsed();
 }
 
+bool YulStack::analyze(std::string const& _sourceName, std::string const& _source, std::shared_ptr<Object> _object)
+{
+	m_errors.clear();
+	yulAssert(m_stackState == Empty);
+	yulAssert(_object && _object->hasCode());
+
+	m_charStream = std::make_unique<CharStream>(_source, _sourceName);
+	m_parserResult = std::move(_object);
+	m_stackState = Parsed;
+
+	return analyzeParsed();
+}
+
 void YulStack::optimize()
 {
 	yulAssert(m_stackState >= AnalysisSuccessful, "Analysis was not successful.");
@@ -136,7 +149,8 @@ void YulStack::optimize()
 				optimizeStackAllocation,
 				yulOptimiserSteps,
 				yulOptimiserCleanupSteps,
-				m_optimiserSettings.expectedExecutionsPerDeployment
+				m_optimiserSettings.expectedExecutionsPerDeployment,
+				m_optimiserSettings.executionProfile.empty() ? nullptr : &m_optimiserSettings.executionProfile
 			}
 		);
 
@@ -402,7 +416,8 @@ Json YulStack::cfgJson() const
 			*_object.analysisInfo,
 			languageToDialect(m_language, m_evmVersion, m_eofVersion),
 			_object.code()->root(),
-			keepLiteralAssignments
+			keepLiteralAssignments,
+			m_eofVersion.has_value()
 		);
 		std::unique_ptr<ssa::ControlFlowLiveness> liveness = std::make_unique<ssa::ControlFlowLiveness>(*controlFlow);
 		return ssa::json::exportControlFlow(*controlFlow, liveness.get());
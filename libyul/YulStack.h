@@ -112,6 +112,10 @@ public:
 	/// Runs parsing and analysis steps, returns false if input cannot be assembled.
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
+	/// Runs the analysis step on @a _object instead of parsing @a _source, which has to be the
+	/// source of an equivalent object. It is kept as the original source.
+	/// @returns false if input cannot be assembled.
+	bool analyze(std::string const& _sourceName, std::string const& _source, std::shared_ptr<Object> _object);
 
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
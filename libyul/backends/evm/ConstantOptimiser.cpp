@@ -28,6 +28,8 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <mutex>
+#include <tuple>
 #include <variant>
 
 using namespace solidity;
@@ -87,6 +89,22 @@ struct MiniEVMInterpreter
 
 	EVMDialect const& m_dialect;
 };
+
+/// @returns a copy of @a _expression with all debug data replaced by @a _debugData.
+Expression copyWithDebugData(Expression const& _expression, langutil::DebugData::ConstPtr const& _debugData)
+{
+	if (Literal const* literal = std::get_if<Literal>(&_expression))
+		return Literal{_debugData, literal->kind, literal->value};
+	FunctionCall const& call = std::get<FunctionCall>(_expression);
+	std::vector<Expression> arguments;
+	for (Expression const& argument: call.arguments)
+		arguments.emplace_back(copyWithDebugData(argument, _debugData));
+	return FunctionCall{
+		_debugData,
+		BuiltinName{_debugData, std::get<BuiltinName>(call.functionName).handle},
+		std::move(arguments)
+	};
+}
 }
 
 void ConstantOptimiser::visit(Expression& _e)
@@ -97,17 +115,47 @@ void ConstantOptimiser::visit(Expression& _e)
 		if (literal.kind != LiteralKind::Number)
 			return;
 
-		if (
-			Expression const* repr =
-				RepresentationFinder(m_dialect, m_meter, debugDataOf(_e), m_cache)
-				.tryFindRepresentation(literal.value.value())
-		)
-			_e = ASTCopier{}.translate(*repr);
+		if (literal.value.value() < 0x10000)
+			return;
+		if (std::shared_ptr<Representation const> repr = cheapestRepresentation(literal.value.value()))
+			_e = copyWithDebugData(*repr->expression, debugDataOf(_e));
 	}
 	else
 		ASTModifier::visit(_e);
 }
 
+std::shared_ptr<Representation const> ConstantOptimiser::cheapestRepresentation(u256 const& _value) const
+{
+	using Key = std::tuple<langutil::EVMVersion, std::optional<uint8_t>, bool, bigint, u256>;
+	// The same constants (masks, shifted selectors, ...) occur in most contracts. The number of
+	// distinct constants is small in practice, the bound only protects long-running processes.
+	static size_t constexpr maxCacheSize = 1 << 16;
+	static std::mutex mutex;
+	static std::map<Key, std::shared_ptr<Representation const>> cache;
+
+	Key key{m_dialect.evmVersion(), m_dialect.eofVersion(), m_meter.isCreation(), m_meter.runs(), _value};
+	{
+		std::lock_guard lock(mutex);
+		if (auto it = cache.find(key); it != cache.end())
+			return it->second;
+	}
+
+	// Every value is searched with a fresh step budget and intermediate cache, so that
+	// the result does not depend on the values that were searched before.
+	std::map<u256, Representation> intermediateResults;
+	std::shared_ptr<Representation const> result;
+	if (
+		RepresentationFinder(m_dialect, m_meter, langutil::DebugData::create(), intermediateResults)
+		.tryFindRepresentation(_value)
+	)
+		result = std::make_shared<Representation const>(std::move(intermediateResults.at(_value)));
+
+	std::lock_guard lock(mutex);
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	return cache.emplace(std::move(key), std::move(result)).first->second;
+}
+
 Expression const* RepresentationFinder::tryFindRepresentation(u256 const& _value)
 {
 	if (_value < 0x10000)
@@ -43,6 +43,9 @@ class GasMeter;
 /**
  * Optimisation stage that replaces constants by expressions that compute them.
  *
+ * The cheapest representation of a constant only depends on the EVM version and the
+ * settings of the gas meter, so the results are shared between all instances in the process.
+ *
  * Prerequisite: None
  */
 class ConstantOptimiser: public ASTModifier
@@ -62,9 +65,12 @@ public:
 	};
 
 private:
+	/// @returns the cheapest representation of @a _value if it is cheaper than the literal
+	/// and nullptr otherwise. The expression does not contain debug data.
+	std::shared_ptr<Representation const> cheapestRepresentation(u256 const& _value) const;
+
 	EVMDialect const& m_dialect;
 	GasMeter const& m_meter;
-	std::map<u256, Representation> m_cache;
 };
 
 class RepresentationFinder
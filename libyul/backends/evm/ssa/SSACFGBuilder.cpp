@@ -23,6 +23,8 @@
 
 #include <libyul/backends/evm/ssa/ControlFlow.h>
 
+#include <libyul/backends/evm/EVMDialect.h>
+
 #include <libyul/AST.h>
 #include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libyul/Exceptions.h>
@@ -51,14 +53,16 @@ SSACFGBuilder::SSACFGBuilder(
 	AsmAnalysisInfo const& _analysisInfo,
 	ControlFlowSideEffectsCollector const& _sideEffects,
 	Dialect const& _dialect,
-	bool _keepLiteralAssignments
+	bool _keepLiteralAssignments,
+	bool _useJumpTables
 ):
 	m_controlFlow(_controlFlow),
 	m_graph(_graph),
 	m_info(_analysisInfo),
 	m_sideEffects(_sideEffects),
 	m_dialect(_dialect),
-	m_keepLiteralAssignments(_keepLiteralAssignments)
+	m_keepLiteralAssignments(_keepLiteralAssignments),
+	m_useJumpTables(_useJumpTables)
 {
 }
 
@@ -66,7 +70,8 @@ std::unique_ptr<ControlFlow> SSACFGBuilder::build(
 	AsmAnalysisInfo const& _analysisInfo,
 	Dialect const& _dialect,
 	Block const& _block,
-	bool _keepLiteralAssignments
+	bool _keepLiteralAssignments,
+	bool _useJumpTables
 )
 {
 	ControlFlowSideEffectsCollector sideEffects(_dialect, _block);
@@ -75,7 +80,7 @@ std::unique_ptr<ControlFlow> SSACFGBuilder::build(
 	controlFlow->functionGraphs.emplace_back(std::make_unique<SSACFG>());
 	controlFlow->functionGraphMapping.emplace_back(nullptr, controlFlow->functionGraphs.back().get());
 	SSACFG& mainGraph = *controlFlow->functionGraphs.back();
-	SSACFGBuilder builder(*controlFlow, mainGraph, _analysisInfo, sideEffects, _dialect, _keepLiteralAssignments);
+	SSACFGBuilder builder(*controlFlow, mainGraph, _analysisInfo, sideEffects, _dialect, _keepLiteralAssignments, _useJumpTables);
 	builder.m_currentBlock = mainGraph.makeBlock(debugDataOf(_block));
 	builder.sealBlock(builder.m_currentBlock);
 	builder(_block);
@@ -172,7 +177,11 @@ void SSACFGBuilder::cleanUnreachable()
 					_addChild(_jump.zero);
 					_addChild(_jump.nonZero);
 				},
-				[](SSACFG::BasicBlock::JumpTable const&) { yulAssert(false); },
+				[&](SSACFG::BasicBlock::JumpTable const& _jumpTable) {
+					for (auto caseBlock: _jumpTable.cases | ranges::views::values)
+						_addChild(caseBlock);
+					_addChild(_jumpTable.defaultCase);
+				},
 				[](SSACFG::BasicBlock::FunctionReturn const&) {},
 				[](SSACFG::BasicBlock::Terminated const&) {},
 				[](SSACFG::BasicBlock::MainExit const&) {}
@@ -232,7 +241,7 @@ void SSACFGBuilder::buildFunctionGraph(
 	cfg.arguments = arguments;
 	cfg.returns = returns;
 
-	SSACFGBuilder builder(m_controlFlow, cfg, m_info, m_sideEffects, m_dialect, m_keepLiteralAssignments);
+	SSACFGBuilder builder(m_controlFlow, cfg, m_info, m_sideEffects, m_dialect, m_keepLiteralAssignments, m_useJumpTables);
 	builder.m_currentBlock = cfg.entry;
 	builder.m_functionDefinitions = m_functionDefinitions;
 	for (auto&& [var, varId]: cfg.arguments)
@@ -312,14 +321,69 @@ void SSACFGBuilder::operator()(Switch const& _switch)
 {
 	auto expression = std::visit(*this, *_switch.expression);
 
-	auto useJumpTableForSwitch = [](Switch const&) {
-		// TODO: check for EOF support & tight switch values.
-		return false;
+	// Dispatching through a relative jump table (RJUMPV) costs a constant amount of gas, while
+	// a chain of comparisons costs gas proportional to the number of cases checked. The table
+	// needs two bytes of code per value in the range of the cases, though, so it is only used
+	// for switches that have enough cases and whose values are dense.
+	auto useJumpTableForSwitch = [&](Switch const& _switch) -> std::optional<u256> {
+		if (!m_useJumpTables)
+			return std::nullopt;
+		auto const* evmDialect = dynamic_cast<EVMDialect const*>(&m_dialect);
+		yulAssert(evmDialect && evmDialect->eofVersion().has_value(), "Jump tables require EOF.");
+		if (std::holds_alternative<Literal>(*_switch.expression))
+			return std::nullopt;
+
+		std::optional<u256> minValue;
+		std::optional<u256> maxValue;
+		size_t numCases = 0;
+		for (auto const& switchCase: _switch.cases)
+			if (switchCase.value)
+			{
+				u256 const value = switchCase.value->value.value();
+				if (!minValue || value < *minValue)
+					minValue = value;
+				if (!maxValue || value > *maxValue)
+					maxValue = value;
+				++numCases;
+			}
+		// With less cases the comparisons are at most as expensive as the table lookup.
+		if (numCases < 3)
+			return std::nullopt;
+		// RJUMPV encodes the maximum index in a single byte.
+		u256 const range = *maxValue - *minValue + 1;
+		if (range > 256)
+			return std::nullopt;
+		// A comparison takes about seven bytes of code (DUP, PUSH, EQ, RJUMPI).
+		if (range * 2 > numCases * 7)
+			return std::nullopt;
+		return minValue;
 	};
-	if (useJumpTableForSwitch(_switch))
+	if (std::optional<u256> const offset = useJumpTableForSwitch(_switch))
 	{
-		// TODO: also generate a subtraction to shift tight, but non-zero switch cases - or, alternative,
-		// transform to zero-based tight switches on Yul if possible.
+		// Shift the values so that the smallest case is at index zero. Smaller values wrap
+		// around and end up outside of the table, i.e. in the default case.
+		if (*offset != 0)
+		{
+			std::optional<BuiltinHandle> subHandle = m_dialect.findBuiltin("sub");
+			yulAssert(subHandle);
+			FunctionCall const& ghostCall = m_graph.ghostCalls.emplace_back(FunctionCall{
+				debugDataOf(_switch),
+				BuiltinName{{}, *subHandle},
+				{}
+			});
+			auto shiftedValue = m_graph.newVariable(m_currentBlock);
+			currentBlock().operations.emplace_back(SSACFG::Operation{
+				{shiftedValue},
+				SSACFG::BuiltinCall{
+					debugDataOf(_switch),
+					m_dialect.builtin(*subHandle),
+					ghostCall
+				},
+				{m_graph.newLiteral(debugDataOf(_switch), *offset), expression}
+			});
+			expression = shiftedValue;
+		}
+
 		std::map<u256, SSACFG::BlockId> cases;
 		std::optional<SSACFG::BlockId> defaultCase;
 		std::vector<std::tuple<SSACFG::BlockId, std::reference_wrapper<Block const>>> children;
@@ -327,7 +391,7 @@ void SSACFGBuilder::operator()(Switch const& _switch)
 		{
 			auto blockId = m_graph.makeBlock(debugDataOf(_case.body));
 			if (_case.value)
-				cases[_case.value->value.value()] = blockId;
+				cases[_case.value->value.value() - *offset] = blockId;
 			else
 				defaultCase = blockId;
 			children.emplace_back(blockId, std::ref(_case.body));
@@ -45,7 +45,8 @@ class SSACFGBuilder
 		AsmAnalysisInfo const& _analysisInfo,
 		ControlFlowSideEffectsCollector const& _sideEffects,
 		Dialect const& _dialect,
-		bool _keepLiteralAssignments
+		bool _keepLiteralAssignments,
+		bool _useJumpTables
 	);
 public:
 	SSACFGBuilder(SSACFGBuilder const&) = delete;
@@ -54,7 +55,8 @@ public:
 		AsmAnalysisInfo const& _analysisInfo,
 		Dialect const& _dialect,
 		Block const& _block,
-		bool _keepLiteralAssignments
+		bool _keepLiteralAssignments,
+		bool _useJumpTables = false
 	);
 
 	void operator()(ExpressionStatement const& _statement);
@@ -95,6 +97,8 @@ private:
 	ControlFlowSideEffectsCollector const& m_sideEffects;
 	Dialect const& m_dialect;
 	bool const m_keepLiteralAssignments;
+	/// Lowers dense switches to jump tables instead of chains of comparisons. Requires EOF.
+	bool const m_useJumpTables;
 	std::vector<std::tuple<Scope::Function const*, FunctionDefinition const*>> m_functionDefinitions;
 	SSACFG::BlockId m_currentBlock;
 	SSACFG::BasicBlock& currentBlock() { return m_graph.block(m_currentBlock); }
@@ -163,8 +163,18 @@ Json exportBlock(SSACFG const& _cfg, SSACFG::BlockId _entryId, LivenessAnalysis
 			[&](SSACFG::BasicBlock::Terminated const&) {
 				exitBlockJson["type"] = "Terminated";
 			},
-			[&](SSACFG::BasicBlock::JumpTable const&) {
-				yulAssert(false);
+			[&](SSACFG::BasicBlock::JumpTable const& _jumpTable) {
+				exitBlockJson["targets"] = Json::array();
+				for (auto const& [value, target]: _jumpTable.cases)
+				{
+					exitBlockJson["targets"].emplace_back("Block" + std::to_string(target.value));
+					_addChild(target);
+				}
+				exitBlockJson["default"] = "Block" + std::to_string(_jumpTable.defaultCase.value);
+				exitBlockJson["cond"] = _jumpTable.value.str(_cfg);
+				exitBlockJson["type"] = "JumpTable";
+
+				_addChild(_jumpTable.defaultCase);
 			}
 		}, block.exit);
 		blockJson["exit"] = exitBlockJson;
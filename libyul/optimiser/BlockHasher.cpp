@@ -239,3 +239,196 @@ void ExpressionHasher::operator()(FunctionCall const& _funCall)
 	hashFunctionCall(_funCall);
 	ASTWalker::operator()(_funCall);
 }
+
+h256 StructuralHasher::run(Block const& _block)
+{
+	StructuralHasher hasher;
+	hasher(_block);
+	return hasher.m_hasher.hash();
+}
+
+void StructuralHasher::operator()(Literal const& _literal)
+{
+	hashNode(NodeKind::Literal, _literal.debugData);
+	hashNumber(static_cast<uint64_t>(_literal.kind));
+	// The printed value, i.e. the hint if there is one.
+	if (_literal.value.unlimited())
+		hashString(_literal.value.builtinStringLiteralValue());
+	else if (_literal.value.hint())
+		hashString(*_literal.value.hint());
+	else
+		hashString(formatLiteral(_literal, false /* _validated */));
+}
+
+void StructuralHasher::operator()(Identifier const& _identifier)
+{
+	hashNode(NodeKind::Identifier, _identifier.debugData);
+	hashName(_identifier.name);
+}
+
+void StructuralHasher::operator()(FunctionCall const& _funCall)
+{
+	hashNode(NodeKind::FunctionCall, _funCall.debugData);
+	GenericVisitor visitor{
+		[&](BuiltinName const& _builtin)
+		{
+			hashNode(NodeKind::BuiltinName, _builtin.debugData);
+			hashNumber(_builtin.handle.id);
+		},
+		[&](Identifier const& _identifier)
+		{
+			(*this)(_identifier);
+		}
+	};
+	std::visit(visitor, _funCall.functionName);
+	hashNumber(_funCall.arguments.size());
+	walkVector(_funCall.arguments);
+}
+
+void StructuralHasher::operator()(ExpressionStatement const& _statement)
+{
+	hashNode(NodeKind::ExpressionStatement, _statement.debugData);
+	visit(_statement.expression);
+}
+
+void StructuralHasher::operator()(Assignment const& _assignment)
+{
+	hashNode(NodeKind::Assignment, _assignment.debugData);
+	hashNumber(_assignment.variableNames.size());
+	for (auto const& name: _assignment.variableNames)
+		(*this)(name);
+	visit(*_assignment.value);
+}
+
+void StructuralHasher::operator()(VariableDeclaration const& _varDecl)
+{
+	hashNode(NodeKind::VariableDeclaration, _varDecl.debugData);
+	hashNumber(_varDecl.variables.size());
+	for (auto const& variable: _varDecl.variables)
+	{
+		hashDebugData(variable.debugData);
+		hashName(variable.name);
+	}
+	hashNumber(_varDecl.value != nullptr);
+	if (_varDecl.value)
+		visit(*_varDecl.value);
+}
+
+void StructuralHasher::operator()(If const& _if)
+{
+	hashNode(NodeKind::If, _if.debugData);
+	visit(*_if.condition);
+	(*this)(_if.body);
+}
+
+void StructuralHasher::operator()(Switch const& _switch)
+{
+	hashNode(NodeKind::Switch, _switch.debugData);
+	visit(*_switch.expression);
+	hashNumber(_switch.cases.size());
+	for (auto const& switchCase: _switch.cases)
+	{
+		// The debug data of cases is not printed.
+		hashNode(NodeKind::Case, nullptr);
+		hashNumber(switchCase.value != nullptr);
+		if (switchCase.value)
+			(*this)(*switchCase.value);
+		(*this)(switchCase.body);
+	}
+}
+
+void StructuralHasher::operator()(FunctionDefinition const& _functionDefinition)
+{
+	hashNode(NodeKind::FunctionDefinition, _functionDefinition.debugData);
+	hashName(_functionDefinition.name);
+	for (auto const* variables: {&_functionDefinition.parameters, &_functionDefinition.returnVariables})
+	{
+		hashNumber(variables->size());
+		for (auto const& variable: *variables)
+		{
+			hashDebugData(variable.debugData);
+			hashName(variable.name);
+		}
+	}
+	(*this)(_functionDefinition.body);
+}
+
+void StructuralHasher::operator()(ForLoop const& _loop)
+{
+	hashNode(NodeKind::ForLoop, _loop.debugData);
+	(*this)(_loop.pre);
+	visit(*_loop.condition);
+	(*this)(_loop.post);
+	(*this)(_loop.body);
+}
+
+void StructuralHasher::operator()(Break const& _break)
+{
+	hashNode(NodeKind::Break, _break.debugData);
+}
+
+void StructuralHasher::operator()(Continue const& _continue)
+{
+	hashNode(NodeKind::Continue, _continue.debugData);
+}
+
+void StructuralHasher::operator()(Leave const& _leave)
+{
+	hashNode(NodeKind::Leave, _leave.debugData);
+}
+
+void StructuralHasher::operator()(Block const& _block)
+{
+	hashNode(NodeKind::Block, _block.debugData);
+	hashNumber(_block.statements.size());
+	walkVector(_block.statements);
+}
+
+void StructuralHasher::hashNode(NodeKind _kind, langutil::DebugData::ConstPtr const& _debugData)
+{
+	uint8_t const kind = static_cast<uint8_t>(_kind);
+	m_hasher.update(bytesConstRef(&kind, 1));
+	hashDebugData(_debugData);
+}
+
+void StructuralHasher::hashDebugData(langutil::DebugData::ConstPtr const& _debugData)
+{
+	// Follows AsmPrinter::formatDebugData: The AST ID is printed for every node that has one,
+	// the origin location only if it differs from the last one printed.
+	bool const hasAstID = _debugData && _debugData->astID.has_value();
+	hashNumber(hasAstID);
+	if (hasAstID)
+		hashNumber(static_cast<uint64_t>(*_debugData->astID));
+
+	if (!_debugData || _debugData->originLocation == m_lastLocation)
+	{
+		hashNumber(0);
+		return;
+	}
+	m_lastLocation = _debugData->originLocation;
+	hashNumber(1);
+	hashNumber(static_cast<uint64_t>(m_lastLocation.start));
+	hashNumber(static_cast<uint64_t>(m_lastLocation.end));
+	hashNumber(m_lastLocation.sourceName != nullptr);
+	if (m_lastLocation.sourceName)
+		hashString(*m_lastLocation.sourceName);
+}
+
+void StructuralHasher::hashName(YulName _name)
+{
+	hashString(_name.str());
+}
+
+void StructuralHasher::hashString(std::string_view _value)
+{
+	hashNumber(_value.size());
+	m_hasher.update(_value);
+}
+
+void StructuralHasher::hashNumber(uint64_t _value)
+{
+	uint8_t buffer[8];
+	for (size_t i = 0; i < 8; ++i)
+		buffer[i] = static_cast<uint8_t>(_value >> (8 * i));
+	m_hasher.update(bytesConstRef(buffer, 8));
+}
@@ -24,6 +24,10 @@
 #include <libyul/ASTForward.h>
 #include <libyul/YulName.h>
 
+#include <liblangutil/DebugData.h>
+
+#include <libsolutil/Keccak256.h>
+
 namespace solidity::yul
 {
 
@@ -140,6 +144,70 @@ public:
 	void operator()(FunctionCall const& _funCall) override;
 };
 
+/**
+ * Computes a Keccak-256 hash of a block that covers everything AsmPrinter prints with all
+ * debug info included: the structure, the names of all identifiers, the printed values of
+ * literals and the origin locations and AST IDs (but not the native locations) of the nodes.
+ * Blocks that print identically get the same hash. Up to hash collisions, blocks that print
+ * differently get different hashes.
+ *
+ * The nodes are streamed directly into the hash state, the code is never converted to text.
+ */
+class StructuralHasher: public ASTWalker
+{
+public:
+	static util::h256 run(Block const& _block);
+
+	using ASTWalker::operator();
+
+	void operator()(Literal const&) override;
+	void operator()(Identifier const&) override;
+	void operator()(FunctionCall const& _funCall) override;
+	void operator()(ExpressionStatement const& _statement) override;
+	void operator()(Assignment const& _assignment) override;
+	void operator()(VariableDeclaration const& _varDecl) override;
+	void operator()(If const& _if) override;
+	void operator()(Switch const& _switch) override;
+	void operator()(FunctionDefinition const&) override;
+	void operator()(ForLoop const&) override;
+	void operator()(Break const&) override;
+	void operator()(Continue const&) override;
+	void operator()(Leave const&) override;
+	void operator()(Block const& _block) override;
+
+private:
+	enum class NodeKind: uint8_t
+	{
+		Literal,
+		Identifier,
+		BuiltinName,
+		FunctionCall,
+		ExpressionStatement,
+		Assignment,
+		VariableDeclaration,
+		If,
+		Switch,
+		Case,
+		FunctionDefinition,
+		ForLoop,
+		Break,
+		Continue,
+		Leave,
+		Block
+	};
+
+	void hashNode(NodeKind _kind, langutil::DebugData::ConstPtr const& _debugData);
+	void hashDebugData(langutil::DebugData::ConstPtr const& _debugData);
+	void hashName(YulName _name);
+	void hashString(std::string_view _value);
+	void hashNumber(uint64_t _value);
+
+	util::Keccak256Hasher m_hasher;
+	/// Origin location of the previously hashed debug data. Like in the printed code, a location
+	/// that repeats the previous one is hashed as a single marker.
+	langutil::SourceLocation m_lastLocation;
+};
+
 struct ExpressionHash
 {
 	uint64_t operator()(Expression const& _expression) const
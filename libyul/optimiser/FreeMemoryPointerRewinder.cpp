@@ -0,0 +1,570 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimisation stage that lets loop iterations reuse the memory allocated by the
+ * previous iteration.
+ */
+
+#include <libyul/optimiser/FreeMemoryPointerRewinder.h>
+
+#include <libyul/optimiser/FunctionCallFinder.h>
+#include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/optimiser/SSAValueTracker.h>
+#include <libyul/AST.h>
+#include <libyul/Dialect.h>
+#include <libyul/Exceptions.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <algorithm>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+namespace
+{
+
+/// How a value changes if the free memory pointer is rewound at the start of each iteration.
+enum class Dependency
+{
+	/// The value does not change.
+	None,
+	/// The value is a pointer into memory allocated in the current iteration and is lower by
+	/// the amount of memory allocated in the previous iterations.
+	Shifted,
+	/// The value can change in any way.
+	Unknown
+};
+
+Dependency join(Dependency _a, Dependency _b)
+{
+	return _a == _b ? _a : Dependency::Unknown;
+}
+
+/// Arguments of builtins that are only used as memory addresses.
+std::map<std::string_view, std::set<size_t>> const& memoryAddressArguments()
+{
+	static std::map<std::string_view, std::set<size_t>> const arguments{
+		{"keccak256", {0}},
+		{"mcopy", {0, 1}},
+		{"calldatacopy", {0}},
+		{"codecopy", {0}},
+		{"returndatacopy", {0}},
+		{"extcodecopy", {1}},
+		{"datacopy", {0}},
+		{"log0", {0}},
+		{"log1", {0}},
+		{"log2", {0}},
+		{"log3", {0}},
+		{"log4", {0}},
+		{"return", {0}},
+		{"revert", {0}},
+		{"create", {1}},
+		{"create2", {1}},
+		{"call", {3, 5}},
+		{"callcode", {3, 5}},
+		{"delegatecall", {2, 4}},
+		{"staticcall", {2, 4}},
+		{"extcall", {1}},
+		{"extdelegatecall", {1}},
+		{"extstaticcall", {1}},
+		{"eofcreate", {3}},
+		{"returncontract", {1}},
+		{"setimmutable", {0}},
+	};
+	return arguments;
+}
+
+}
+
+/**
+ * Abstract interpretation of a loop iteration that determines how the values of the variables
+ * depend on the memory allocated in the iteration and whether any of them escape.
+ */
+class FreeMemoryPointerRewinder::IterationAnalyser
+{
+public:
+	IterationAnalyser(
+		Dialect const& _dialect,
+		Block const& _ast,
+		std::map<YulName, Expression const*> const& _ssaValues
+	):
+		m_dialect(_dialect),
+		m_functions(allFunctionDefinitions(_ast)),
+		m_ssaValues(_ssaValues)
+	{}
+
+	/// @returns true if rewinding the free memory pointer at the start of the body of
+	/// @a _loop does not change the semantics and the loop allocates memory.
+	bool canRewind(ForLoop const& _loop)
+	{
+		yulAssert(_loop.condition);
+		m_state = {};
+		m_escapes = false;
+		m_writesFreeMemoryPointer = false;
+		m_insideFunction = false;
+		m_loops = {LoopStates{}};
+		m_leaveState.reset();
+		m_iterationVariables = NameCollector(_loop.body, NameCollector::OnlyVariables).names();
+		m_iterationVariables += NameCollector(_loop.post, NameCollector::OnlyVariables).names();
+
+		// The condition and the post block run after an iteration and must not depend on
+		// it either.
+		(*this)(_loop.body);
+		(*this)(_loop.post);
+		requireNone(evaluateSingle(*_loop.condition));
+
+		return !m_escapes && m_writesFreeMemoryPointer;
+	}
+
+private:
+	/// Dependencies of the variables. Variables that are not contained do not depend on the iteration.
+	using State = std::map<YulName, Dependency>;
+
+	struct LoopStates
+	{
+		std::optional<State> breakState;
+		std::optional<State> continueState;
+	};
+
+	struct FunctionSummary
+	{
+		bool escapes = true;
+		bool writesFreeMemoryPointer = true;
+		std::vector<Dependency> returnValues;
+	};
+
+public:
+	void operator()(Block const& _block)
+	{
+		for (Statement const& statement: _block.statements)
+			std::visit(*this, statement);
+	}
+
+	void operator()(ExpressionStatement const& _statement)
+	{
+		evaluate(_statement.expression);
+	}
+
+	void operator()(VariableDeclaration const& _declaration)
+	{
+		std::vector<Dependency> values =
+			_declaration.value ?
+			evaluate(*_declaration.value) :
+			std::vector<Dependency>(_declaration.variables.size(), Dependency::None);
+		yulAssert(values.size() == _declaration.variables.size());
+		for (size_t i = 0; i < values.size(); ++i)
+			m_state[_declaration.variables[i].name] = values[i];
+	}
+
+	void operator()(Assignment const& _assignment)
+	{
+		std::vector<Dependency> values = evaluate(*_assignment.value);
+		yulAssert(values.size() == _assignment.variableNames.size());
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			YulName variable = _assignment.variableNames[i].name;
+			if (!m_insideFunction && !m_iterationVariables.count(variable))
+				requireNone(values[i]);
+			m_state[variable] = values[i];
+		}
+	}
+
+	void operator()(If const& _if)
+	{
+		requireNone(evaluateSingle(*_if.condition));
+		State before = m_state;
+		(*this)(_if.body);
+		m_state = joinStates(before, m_state);
+	}
+
+	void operator()(Switch const& _switch)
+	{
+		requireNone(evaluateSingle(*_switch.expression));
+		State before = m_state;
+		std::optional<State> after;
+		bool hasDefault = false;
+		for (Case const& switchCase: _switch.cases)
+		{
+			hasDefault = hasDefault || !switchCase.value;
+			m_state = before;
+			(*this)(switchCase.body);
+			joinInto(after, m_state);
+		}
+		if (!hasDefault)
+			joinInto(after, before);
+		m_state = std::move(*after);
+	}
+
+	void operator()(ForLoop const& _loop)
+	{
+		(*this)(_loop.pre);
+		m_loops.emplace_back();
+		while (true)
+		{
+			State head = m_state;
+			requireNone(evaluateSingle(*_loop.condition));
+			(*this)(_loop.body);
+			if (m_loops.back().continueState)
+				m_state = joinStates(m_state, *m_loops.back().continueState);
+			(*this)(_loop.post);
+			m_state = joinStates(head, m_state);
+			if (m_state == head)
+				break;
+		}
+		if (m_loops.back().breakState)
+			m_state = joinStates(m_state, *m_loops.back().breakState);
+		m_loops.pop_back();
+	}
+
+	void operator()(FunctionDefinition const&) {}
+
+	void operator()(Break const&)
+	{
+		yulAssert(!m_loops.empty());
+		joinInto(m_loops.back().breakState, m_state);
+	}
+
+	void operator()(Continue const&)
+	{
+		yulAssert(!m_loops.empty());
+		joinInto(m_loops.back().continueState, m_state);
+	}
+
+	void operator()(Leave const&)
+	{
+		if (m_insideFunction)
+			joinInto(m_leaveState, m_state);
+	}
+
+private:
+	static Dependency dependency(State const& _state, YulName _variable)
+	{
+		return valueOrDefault(_state, _variable, Dependency::None);
+	}
+
+	static State joinStates(State const& _a, State const& _b)
+	{
+		State result = _a;
+		for (auto& [variable, value]: result)
+			value = join(value, dependency(_b, variable));
+		for (auto const& [variable, value]: _b)
+			if (!_a.count(variable))
+				result[variable] = join(Dependency::None, value);
+		return result;
+	}
+
+	static void joinInto(std::optional<State>& _target, State const& _state)
+	{
+		_target = _target ? joinStates(*_target, _state) : _state;
+	}
+
+	void requireNone(Dependency _dependency)
+	{
+		if (_dependency != Dependency::None)
+			m_escapes = true;
+	}
+
+	/// Memory has to be accessed through pointers into the memory of the iteration or at
+	/// constant addresses below the memory managed by the free memory pointer. Any other
+	/// address could point into memory that is reused by the next iteration after rewinding.
+	void requireAddress(Expression const& _address, Dependency _dependency)
+	{
+		if (_dependency == Dependency::Shifted)
+			return;
+		std::optional<u256> address = constantValue(_address);
+		if (_dependency == Dependency::Unknown || !address || *address >= 128)
+			m_escapes = true;
+	}
+
+	Dependency evaluateSingle(Expression const& _expression)
+	{
+		std::vector<Dependency> values = evaluate(_expression);
+		yulAssert(values.size() == 1);
+		return values.front();
+	}
+
+	std::vector<Dependency> evaluate(Expression const& _expression)
+	{
+		if (Identifier const* identifier = std::get_if<Identifier>(&_expression))
+			return {dependency(m_state, identifier->name)};
+		if (std::holds_alternative<Literal>(_expression))
+			return {Dependency::None};
+
+		FunctionCall const& call = std::get<FunctionCall>(_expression);
+		std::vector<Dependency> arguments;
+		for (Expression const& argument: call.arguments)
+			arguments.emplace_back(evaluateSingle(argument));
+
+		if (BuiltinName const* builtin = std::get_if<BuiltinName>(&call.functionName))
+			return evaluateBuiltin(m_dialect.builtin(builtin->handle), call, arguments);
+
+		FunctionSummary const& summary = functionSummary(std::get<Identifier>(call.functionName).name, arguments);
+		if (summary.escapes)
+			m_escapes = true;
+		if (summary.writesFreeMemoryPointer)
+			m_writesFreeMemoryPointer = true;
+		return summary.returnValues;
+	}
+
+	std::vector<Dependency> evaluateBuiltin(
+		BuiltinFunction const& _builtin,
+		FunctionCall const& _call,
+		std::vector<Dependency> const& _arguments
+	)
+	{
+		std::string_view const name = _builtin.name;
+		auto argumentsAre = [&](Dependency _first, Dependency _second) {
+			return _arguments.at(0) == _first && _arguments.at(1) == _second;
+		};
+		bool const dependsOnIteration = std::any_of(_arguments.begin(), _arguments.end(), [](Dependency _argument) {
+			return _argument != Dependency::None;
+		});
+
+		if (name == "mload")
+		{
+			std::optional<u256> address = constantValue(_call.arguments.at(0));
+			if (address == 64)
+				return {Dependency::Shifted};
+			if (address && *address > 32 && *address < 96)
+				m_escapes = true;
+			requireAddress(_call.arguments.at(0), _arguments.at(0));
+			// Pointers are never stored in memory, see below.
+			return {Dependency::None};
+		}
+		else if (name == "mstore" || name == "mstore8")
+		{
+			requireAddress(_call.arguments.at(0), _arguments.at(0));
+			std::optional<u256> address = constantValue(_call.arguments.at(0));
+			if (address && (name == "mstore" ? *address > 32 : *address >= 64) && *address < 96)
+			{
+				// Writes to the free memory pointer have to keep it a pointer into the
+				// memory of the iteration.
+				if (name == "mstore" && *address == 64 && _arguments.at(1) == Dependency::Shifted)
+					m_writesFreeMemoryPointer = true;
+				else
+					m_escapes = true;
+			}
+			else
+				requireNone(_arguments.at(1));
+			return {};
+		}
+		else if (name == "add")
+		{
+			if (argumentsAre(Dependency::Shifted, Dependency::None) || argumentsAre(Dependency::None, Dependency::Shifted))
+				return {Dependency::Shifted};
+		}
+		else if (name == "sub")
+		{
+			if (argumentsAre(Dependency::Shifted, Dependency::None))
+				return {Dependency::Shifted};
+			if (argumentsAre(Dependency::Shifted, Dependency::Shifted))
+				return {Dependency::None};
+		}
+		else if (name == "lt" || name == "gt" || name == "slt" || name == "sgt" || name == "eq")
+		{
+			// Rewinding does not change the order of two pointers into the memory of the same
+			// iteration. Pointers are compared to constants in the overflow checks of allocations
+			// (see finalize_allocation), which the lower pointers after rewinding pass as well.
+			if (argumentsAre(Dependency::Shifted, Dependency::Shifted))
+				return {Dependency::None};
+			if (
+				(argumentsAre(Dependency::Shifted, Dependency::None) && constantValue(_call.arguments.at(1))) ||
+				(argumentsAre(Dependency::None, Dependency::Shifted) && constantValue(_call.arguments.at(0)))
+			)
+				return {Dependency::None};
+		}
+		else if (name == "iszero")
+		{
+			// Allocated memory never starts at address zero.
+			if (_arguments.at(0) == Dependency::Shifted)
+				return {Dependency::None};
+		}
+		else if (auto addressArguments = memoryAddressArguments().find(name); addressArguments != memoryAddressArguments().end())
+		{
+			for (size_t i = 0; i < _arguments.size(); ++i)
+				if (addressArguments->second.count(i))
+					requireAddress(_call.arguments[i], _arguments[i]);
+				else
+					requireNone(_arguments[i]);
+			return std::vector<Dependency>(_builtin.numReturns, Dependency::None);
+		}
+		else if (name.substr(0, 9) == "verbatim_")
+			m_escapes = true;
+
+		if (!dependsOnIteration)
+			return std::vector<Dependency>(_builtin.numReturns, Dependency::None);
+		if (!_builtin.sideEffects.movable)
+			m_escapes = true;
+		return std::vector<Dependency>(_builtin.numReturns, Dependency::Unknown);
+	}
+
+	FunctionSummary const& functionSummary(YulName _function, std::vector<Dependency> const& _arguments)
+	{
+		auto key = std::make_pair(_function, _arguments);
+		if (auto it = m_summaries.find(key); it != m_summaries.end())
+			return it->second;
+		// Recursive calls use the pessimistic default.
+		FunctionSummary& summary = m_summaries[key];
+		FunctionDefinition const* function = valueOrDefault(m_functions, _function, nullptr);
+		yulAssert(function);
+		summary.returnValues.assign(function->returnVariables.size(), Dependency::Unknown);
+
+		ScopedSaveAndRestore state(m_state, State{});
+		ScopedSaveAndRestore escapes(m_escapes, false);
+		ScopedSaveAndRestore writesFreeMemoryPointer(m_writesFreeMemoryPointer, false);
+		ScopedSaveAndRestore insideFunction(m_insideFunction, true);
+		ScopedSaveAndRestore loops(m_loops, std::vector<LoopStates>{});
+		ScopedSaveAndRestore leaveState(m_leaveState, std::optional<State>{});
+
+		yulAssert(function->parameters.size() == _arguments.size());
+		for (size_t i = 0; i < _arguments.size(); ++i)
+			m_state[function->parameters[i].name] = _arguments[i];
+		(*this)(function->body);
+		joinInto(m_leaveState, m_state);
+
+		FunctionSummary result;
+		result.escapes = m_escapes;
+		result.writesFreeMemoryPointer = m_writesFreeMemoryPointer;
+		for (NameWithDebugData const& returnVariable: function->returnVariables)
+			result.returnValues.emplace_back(dependency(*m_leaveState, returnVariable.name));
+		summary = std::move(result);
+		return summary;
+	}
+
+	std::optional<u256> constantValue(Expression const& _expression) const
+	{
+		Expression const* expression = &_expression;
+		if (Identifier const* identifier = std::get_if<Identifier>(expression))
+			if (Expression const* const* value = valueOrNullptr(m_ssaValues, identifier->name))
+				expression = *value;
+		if (Literal const* literal = std::get_if<Literal>(expression))
+			return literal->value.value();
+		return std::nullopt;
+	}
+
+	Dialect const& m_dialect;
+	std::map<YulName, FunctionDefinition const*> const m_functions;
+	std::map<YulName, Expression const*> const& m_ssaValues;
+	std::map<std::pair<YulName, std::vector<Dependency>>, FunctionSummary> m_summaries;
+
+	State m_state;
+	/// Variables declared in the body or post block of the analysed loop.
+	std::set<YulName> m_iterationVariables;
+	bool m_insideFunction = false;
+	std::vector<LoopStates> m_loops;
+	std::optional<State> m_leaveState;
+	bool m_escapes = false;
+	bool m_writesFreeMemoryPointer = false;
+};
+
+void FreeMemoryPointerRewinder::run(OptimiserStepContext& _context, Block& _ast)
+{
+	if (
+		!_context.dialect.memoryLoadFunctionHandle() ||
+		!_context.dialect.memoryStoreFunctionHandle() ||
+		MSizeFinder::containsMSize(_context.dialect, _ast)
+	)
+		return;
+	std::optional<BuiltinHandle> memoryGuard = _context.dialect.findBuiltin("memoryguard");
+	if (!memoryGuard || findFunctionCalls(std::as_const(_ast), *memoryGuard).empty())
+		return;
+
+	SSAValueTracker ssaValues;
+	ssaValues(_ast);
+	FreeMemoryPointerRewinder{_context.dialect, _context.dispenser, _ast, ssaValues.values()}(_ast);
+}
+
+FreeMemoryPointerRewinder::FreeMemoryPointerRewinder(
+	Dialect const& _dialect,
+	NameDispenser& _nameDispenser,
+	Block const& _ast,
+	std::map<YulName, Expression const*> const& _ssaValues
+):
+	m_dialect(_dialect),
+	m_nameDispenser(_nameDispenser),
+	m_analyser(std::make_unique<IterationAnalyser>(_dialect, _ast, _ssaValues))
+{
+}
+
+FreeMemoryPointerRewinder::~FreeMemoryPointerRewinder() = default;
+
+void FreeMemoryPointerRewinder::operator()(Block& _block)
+{
+	ASTModifier::operator()(_block);
+
+	std::optional<BuiltinHandle> const memoryStoreFunctionHandle = m_dialect.memoryStoreFunctionHandle();
+	std::optional<BuiltinHandle> const memoryLoadFunctionHandle = m_dialect.memoryLoadFunctionHandle();
+	yulAssert(memoryStoreFunctionHandle && memoryLoadFunctionHandle);
+	iterateReplacing(_block.statements, [&](Statement& _statement) -> std::optional<std::vector<Statement>> {
+		ForLoop* loop = std::get_if<ForLoop>(&_statement);
+		if (!loop || rewindsFreeMemoryPointer(*loop) || !m_analyser->canRewind(*loop))
+			return {};
+
+		langutil::DebugData::ConstPtr const& debugData = loop->debugData;
+		YulName freeMemoryPointer = m_nameDispenser.newName(YulName{"freeMemoryPointer"});
+		auto freeMemoryPointerAddress = [&]() {
+			return Literal{debugData, LiteralKind::Number, LiteralValue{u256(64)}};
+		};
+		loop->body.statements.insert(loop->body.statements.begin(), ExpressionStatement{
+			debugData,
+			FunctionCall{
+				debugData,
+				BuiltinName{debugData, *memoryStoreFunctionHandle},
+				make_vector<Expression>(freeMemoryPointerAddress(), Identifier{debugData, freeMemoryPointer})
+			}
+		});
+		return make_vector<Statement>(
+			VariableDeclaration{
+				debugData,
+				{NameWithDebugData{debugData, freeMemoryPointer}},
+				std::make_unique<Expression>(FunctionCall{
+					debugData,
+					BuiltinName{debugData, *memoryLoadFunctionHandle},
+					make_vector<Expression>(freeMemoryPointerAddress())
+				})
+			},
+			std::move(_statement)
+		);
+	});
+}
+
+bool FreeMemoryPointerRewinder::rewindsFreeMemoryPointer(ForLoop const& _loop) const
+{
+	std::set<YulName> bodyVariables = NameCollector(_loop.body, NameCollector::OnlyVariables).names();
+	for (Statement const& statement: _loop.body.statements)
+		if (ExpressionStatement const* expression = std::get_if<ExpressionStatement>(&statement))
+			if (FunctionCall const* call = std::get_if<FunctionCall>(&expression->expression))
+				if (
+					std::holds_alternative<BuiltinName>(call->functionName) &&
+					std::get<BuiltinName>(call->functionName).handle == m_dialect.memoryStoreFunctionHandle() &&
+					std::holds_alternative<Literal>(call->arguments.at(0)) &&
+					std::get<Literal>(call->arguments.at(0)).value.value() == 64 &&
+					std::holds_alternative<Identifier>(call->arguments.at(1)) &&
+					!bodyVariables.count(std::get<Identifier>(call->arguments.at(1)).name)
+				)
+					return true;
+	return false;
+}
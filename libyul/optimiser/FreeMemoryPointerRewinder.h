@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimisation stage that lets loop iterations reuse the memory allocated by the
+ * previous iteration.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
+
+#include <map>
+#include <memory>
+
+namespace solidity::yul
+{
+
+class NameDispenser;
+
+/**
+ * Optimisation stage that lets loop iterations reuse the memory allocated by the
+ * previous iteration.
+ *
+ * Memory allocated through the free memory pointer is never released, so a loop that
+ * allocates temporary memory in every iteration keeps expanding memory. If no pointer to
+ * memory allocated in an iteration is used after the iteration, the step stores the free
+ * memory pointer in a variable before the loop and rewinds it at the start of the body:
+ *
+ *   let freeMemoryPointer := mload(64)
+ *   for { } cond { post } { mstore(64, freeMemoryPointer) body }
+ *
+ * The escape analysis tracks values that depend on the free memory pointer through
+ * variables and functions. A pointer escapes if it, or a value computed from it in any
+ * way other than adding offsets, is assigned to a variable declared outside of the loop
+ * body, stored in memory (apart from updating the free memory pointer) or used by an
+ * instruction other than as a memory address. Differences and comparisons of two pointers
+ * into the memory of the same iteration are fine, since they do not change. Comparisons of
+ * a pointer to a constant are fine as well: Memory-safe code only uses them to check that
+ * allocations stay below a limit, which the lower pointers after rewinding do as well.
+ * Comparing a pointer to any other value is an escape. Memory must only be accessed through
+ * pointers into the memory of the iteration or at constant addresses below 128, since any
+ * other address, e.g. a pointer allocated before the loop, could alias the reused memory.
+ *
+ * The step relies on the code being memory-safe and does nothing if there is no
+ * ``memoryguard`` call (see StackLimitEvader). In particular, the free memory pointer
+ * has to be accessed through the constant address 64 and the code must not depend on
+ * the absolute addresses of allocated memory. Code containing ``msize`` is not changed.
+ *
+ * Prerequisite: Disambiguator, ForLoopInitRewriter.
+ */
+class FreeMemoryPointerRewinder: public ASTModifier
+{
+public:
+	static constexpr char const* name{"FreeMemoryPointerRewinder"};
+	static void run(OptimiserStepContext& _context, Block& _ast);
+
+	~FreeMemoryPointerRewinder() override;
+
+	using ASTModifier::operator();
+	void operator()(Block& _block) override;
+
+private:
+	class IterationAnalyser;
+
+	FreeMemoryPointerRewinder(
+		Dialect const& _dialect,
+		NameDispenser& _nameDispenser,
+		Block const& _ast,
+		std::map<YulName, Expression const*> const& _ssaValues
+	);
+
+	/// @returns true if the loop body already rewinds the free memory pointer to a value
+	/// stored before the loop.
+	bool rewindsFreeMemoryPointer(ForLoop const& _loop) const;
+
+	Dialect const& m_dialect;
+	NameDispenser& m_nameDispenser;
+	std::unique_ptr<IterationAnalyser> m_analyser;
+};
+
+}
@@ -46,16 +46,22 @@ using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner inliner{_ast, _context.dispenser, _context.dialect};
+	FullInliner inliner{_ast, _context.dispenser, _context.dialect, _context.executionProfile};
 	inliner.run(Pass::InlineTiny);
 	inliner.run(Pass::InlineRest);
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect,
+	langutil::ExecutionProfile const* _executionProfile
+):
 	m_ast(_ast),
 	m_recursiveFunctions(CallGraphGenerator::callGraph(_ast).recursiveFunctions()),
 	m_nameDispenser(_dispenser),
-	m_dialect(_dialect)
+	m_dialect(_dialect),
+	m_executionProfile(_executionProfile)
 {
 
 	// Determine constants
@@ -238,7 +244,22 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulName _callSite)
 			break;
 		}
 
-	return (size < (aggressiveInlining ? 8u : 6u) || (constantArg && size < (aggressiveInlining ? 16u : 12u)));
+	size_t maxSize = aggressiveInlining ? 8u : 6u;
+	size_t maxSizeWithConstantArg = aggressiveInlining ? 16u : 12u;
+	if (m_executionProfile && _funCall.debugData)
+		if (std::optional<double> frequency = m_executionProfile->relativeFrequency(_funCall.debugData->originLocation))
+		{
+			// Never executed according to the profile: Inlining would only increase the code size.
+			if (*frequency == 0.0)
+				return false;
+			if (*frequency >= 4.0)
+			{
+				maxSize *= 2;
+				maxSizeWithConstantArg *= 2;
+			}
+		}
+
+	return (size < maxSize || (constantArg && size < maxSizeWithConstantArg));
 }
 
 void FullInliner::tentativelyUpdateCodeSize(YulName _function, YulName _callSite)
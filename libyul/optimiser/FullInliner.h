@@ -28,6 +28,7 @@
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/Exceptions.h>
 
+#include <liblangutil/ExecutionProfile.h>
 #include <liblangutil/SourceLocation.h>
 
 #include <optional>
@@ -93,7 +94,12 @@ public:
 private:
 	enum Pass { InlineTiny, InlineRest };
 
-	FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect);
+	FullInliner(
+		Block& _ast,
+		NameDispenser& _dispenser,
+		Dialect const& _dialect,
+		langutil::ExecutionProfile const* _executionProfile = nullptr
+	);
 	void run(Pass _pass);
 
 	/// @returns a map containing the maximum depths of a call chain starting at each
@@ -122,6 +128,9 @@ private:
 	std::map<YulName, size_t> m_functionSizes;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
+	/// Recorded execution counts, if any. Calls that are executed much more often than the
+	/// average may inline larger functions, calls that were never executed only tiny ones.
+	langutil::ExecutionProfile const* m_executionProfile = nullptr;
 };
 
 /**
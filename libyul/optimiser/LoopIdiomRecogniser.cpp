@@ -0,0 +1,255 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimisation stage that replaces loops copying or clearing memory word by word
+ * by a single mcopy or calldatacopy.
+ */
+
+#include <libyul/optimiser/LoopIdiomRecogniser.h>
+
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/SSAValueTracker.h>
+#include <libyul/AST.h>
+#include <libyul/Dialect.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <limits>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+void LoopIdiomRecogniser::run(OptimiserStepContext& _context, Block& _ast)
+{
+	SSAValueTracker ssaValues;
+	ssaValues(_ast);
+	LoopIdiomRecogniser{_context.dialect, ssaValues.values()}(_ast);
+}
+
+void LoopIdiomRecogniser::operator()(Block& _block)
+{
+	ASTModifier::operator()(_block);
+
+	for (size_t index = 0; index < _block.statements.size(); ++index)
+		if (std::holds_alternative<ForLoop>(_block.statements[index]))
+			if (std::optional<Statement> replacement = replaceLoop(_block.statements, index))
+				_block.statements[index] = std::move(*replacement);
+}
+
+std::optional<Statement> LoopIdiomRecogniser::replaceLoop(std::vector<Statement> const& _statements, size_t _loopIndex)
+{
+	ForLoop const& loop = std::get<ForLoop>(_statements[_loopIndex]);
+	if (!loop.pre.statements.empty() || loop.body.statements.size() != 1 || loop.post.statements.size() != 1)
+		return std::nullopt;
+
+	auto inductionInfo = m_analysis.extractInductionVariable(loop, _statements, _loopIndex);
+	if (!inductionInfo)
+		return std::nullopt;
+	auto const& [counter, counterIsFirstArg, initValue] = *inductionInfo;
+
+	// The counter starts at zero right before the loop, so that it is not changed in between.
+	if (!counterIsFirstArg || initValue != 0 || _loopIndex == 0)
+		return std::nullopt;
+	VariableDeclaration const* declaration = std::get_if<VariableDeclaration>(&_statements[_loopIndex - 1]);
+	if (
+		!declaration ||
+		declaration->variables.size() != 1 ||
+		declaration->variables.front().name != counter ||
+		!declaration->value ||
+		!std::holds_alternative<Literal>(*declaration->value)
+	)
+		return std::nullopt;
+
+	// for { } lt(i, n) { i := add(i, 32) }
+	if (!isBuiltinCall(*loop.condition, "lt", 2))
+		return std::nullopt;
+	Expression const& bound = std::get<FunctionCall>(*loop.condition).arguments.at(1);
+	if (Identifier const* boundVariable = std::get_if<Identifier>(&bound); boundVariable && boundVariable->name == counter)
+		return std::nullopt;
+	Assignment const* increment = std::get_if<Assignment>(&loop.post.statements.front());
+	if (!increment || increment->variableNames.size() != 1 || increment->variableNames.front().name != counter)
+		return std::nullopt;
+	Expression const* step = offsetBase(*increment->value, counter);
+	if (!step || !std::holds_alternative<Literal>(*step) || std::get<Literal>(*step).value.value() != 32)
+		return std::nullopt;
+
+	// mstore(add(dst, i), value)
+	ExpressionStatement const* store = std::get_if<ExpressionStatement>(&loop.body.statements.front());
+	if (!store || !isBuiltinCall(store->expression, "mstore", 2))
+		return std::nullopt;
+	auto const& storeArguments = std::get<FunctionCall>(store->expression).arguments;
+	Expression const* destination = offsetBase(storeArguments.at(0), counter);
+	if (!destination)
+		return std::nullopt;
+
+	// The counter is zero instead of a multiple of 32 after the replacement.
+	for (size_t index = _loopIndex + 1; index < _statements.size(); ++index)
+		if (VariableReferencesCounter::countReferences(_statements[index]).count(counter))
+			return std::nullopt;
+
+	// Number of bytes written by the loop: n rounded up to a multiple of 32.
+	langutil::DebugData::ConstPtr const& debugData = loop.debugData;
+	auto literal = [&](u256 _value) { return Literal{debugData, LiteralKind::Number, LiteralValue{_value}}; };
+	std::optional<Expression> length;
+	if (std::optional<u256> boundValue = constantValue(bound))
+	{
+		if (*boundValue > std::numeric_limits<u256>::max() - 31)
+			return std::nullopt;
+		length = literal((*boundValue + 31) / 32 * 32);
+	}
+	else if (std::holds_alternative<Identifier>(bound))
+	{
+		// Rounding up wraps to zero for n > not(31), where the loop runs out of gas. The length is
+		// not(31) in that case, so that the copy runs out of gas as well:
+		// or(and(add(n, 31), not(31)), mul(gt(n, not(31)), not(31)))
+		length = builtinCall(debugData, "or", make_vector<Expression>(
+			builtinCall(debugData, "and", make_vector<Expression>(
+				builtinCall(debugData, "add", make_vector<Expression>(ASTCopier{}.translate(bound), literal(31))),
+				builtinCall(debugData, "not", make_vector<Expression>(literal(31)))
+			)),
+			builtinCall(debugData, "mul", make_vector<Expression>(
+				builtinCall(debugData, "gt", make_vector<Expression>(
+					ASTCopier{}.translate(bound),
+					builtinCall(debugData, "not", make_vector<Expression>(literal(31)))
+				)),
+				builtinCall(debugData, "not", make_vector<Expression>(literal(31)))
+			))
+		));
+	}
+	else
+		// Other bounds are evaluated again in each iteration and could be changed by the stores.
+		return std::nullopt;
+
+	Expression const& value = storeArguments.at(1);
+	std::string_view copyFunction;
+	std::optional<Expression> source;
+	if (Literal const* literal = std::get_if<Literal>(&value))
+	{
+		if (literal->value.value() != 0)
+			return std::nullopt;
+		// Copying from beyond the end of calldata produces zeros.
+		copyFunction = "calldatacopy";
+		source = builtinCall(debugData, "calldatasize", {});
+	}
+	else if (isBuiltinCall(value, "calldataload", 1))
+	{
+		Expression const* sourceBase = offsetBase(std::get<FunctionCall>(value).arguments.front(), counter);
+		if (!sourceBase)
+			return std::nullopt;
+		// The offsets read by the loop wrap around, those of calldatacopy do not. A loop with a variable
+		// bound runs out of gas for memory long before the counter reaches 2**128.
+		std::optional<u256> sourceValue = constantValue(*sourceBase);
+		if (!sourceValue)
+			return std::nullopt;
+		bigint lengthLimit = bigint(1) << 128;
+		if (Literal const* lengthLiteral = std::get_if<Literal>(&*length))
+			lengthLimit = lengthLiteral->value.value();
+		if (bigint(*sourceValue) + lengthLimit > bigint(1) << 256)
+			return std::nullopt;
+		copyFunction = "calldatacopy";
+		source = ASTCopier{}.translate(*sourceBase);
+	}
+	else if (isBuiltinCall(value, "mload", 1) && m_dialect.findBuiltin("mcopy"))
+	{
+		Expression const* sourceBase = offsetBase(std::get<FunctionCall>(value).arguments.front(), counter);
+		if (!sourceBase)
+			return std::nullopt;
+		// Copying forwards word by word only has the semantics of mcopy if no word is
+		// overwritten before it is read.
+		Identifier const* destinationVariable = std::get_if<Identifier>(destination);
+		Identifier const* sourceVariable = std::get_if<Identifier>(sourceBase);
+		bool const sameArea = destinationVariable && sourceVariable && destinationVariable->name == sourceVariable->name;
+		if (!sameArea)
+		{
+			std::optional<u256> destinationValue = constantValue(*destination);
+			std::optional<u256> sourceValue = constantValue(*sourceBase);
+			if (!destinationValue || !sourceValue)
+				return std::nullopt;
+			std::optional<u256> lengthValue;
+			if (Literal const* lengthLiteral = std::get_if<Literal>(&*length))
+				lengthValue = lengthLiteral->value.value();
+			if (
+				*destinationValue > *sourceValue &&
+				(!lengthValue || bigint(*sourceValue) + *lengthValue > *destinationValue)
+			)
+				return std::nullopt;
+		}
+		copyFunction = "mcopy";
+		source = ASTCopier{}.translate(*sourceBase);
+	}
+	else
+		return std::nullopt;
+
+	return ExpressionStatement{debugData, builtinCall(debugData, copyFunction, make_vector<Expression>(
+		ASTCopier{}.translate(*destination),
+		std::move(*source),
+		std::move(*length)
+	))};
+}
+
+bool LoopIdiomRecogniser::isBuiltinCall(Expression const& _expression, std::string_view _name, size_t _arguments) const
+{
+	FunctionCall const* call = std::get_if<FunctionCall>(&_expression);
+	if (!call || call->arguments.size() != _arguments)
+		return false;
+	BuiltinName const* builtin = std::get_if<BuiltinName>(&call->functionName);
+	return builtin && builtin->handle == m_dialect.findBuiltin(_name);
+}
+
+Expression const* LoopIdiomRecogniser::offsetBase(Expression const& _expression, YulName _counter) const
+{
+	if (!isBuiltinCall(_expression, "add", 2))
+		return nullptr;
+	auto const& arguments = std::get<FunctionCall>(_expression).arguments;
+	auto isCounter = [&](Expression const& _argument) {
+		Identifier const* identifier = std::get_if<Identifier>(&_argument);
+		return identifier && identifier->name == _counter;
+	};
+	auto isBase = [&](Expression const& _argument) {
+		return std::holds_alternative<Literal>(_argument) || (std::holds_alternative<Identifier>(_argument) && !isCounter(_argument));
+	};
+	if (isBase(arguments.at(0)) && isCounter(arguments.at(1)))
+		return &arguments.at(0);
+	if (isCounter(arguments.at(0)) && isBase(arguments.at(1)))
+		return &arguments.at(1);
+	return nullptr;
+}
+
+std::optional<u256> LoopIdiomRecogniser::constantValue(Expression const& _expression) const
+{
+	Expression const* expression = &_expression;
+	if (Identifier const* identifier = std::get_if<Identifier>(expression))
+		if (Expression const* const* value = valueOrNullptr(m_ssaValues, identifier->name))
+			expression = *value;
+	if (Literal const* literal = std::get_if<Literal>(expression))
+		return literal->value.value();
+	return std::nullopt;
+}
+
+Expression LoopIdiomRecogniser::builtinCall(
+	langutil::DebugData::ConstPtr const& _debugData,
+	std::string_view _name,
+	std::vector<Expression> _arguments
+) const
+{
+	std::optional<BuiltinHandle> handle = m_dialect.findBuiltin(_name);
+	yulAssert(handle);
+	return FunctionCall{_debugData, BuiltinName{_debugData, *handle}, std::move(_arguments)};
+}
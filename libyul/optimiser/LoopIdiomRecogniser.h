@@ -0,0 +1,100 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimisation stage that replaces loops copying or clearing memory word by word
+ * by a single mcopy or calldatacopy.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/LoopUnrollingAnalysis.h>
+#include <libyul/optimiser/OptimiserStep.h>
+
+#include <map>
+#include <optional>
+#include <string_view>
+
+namespace solidity::yul
+{
+
+/**
+ * Optimisation stage that replaces loops copying or clearing memory word by word
+ * by a single bulk copy:
+ *
+ *   let i := 0
+ *   for { } lt(i, n) { i := add(i, 32) } { mstore(add(dst, i), mload(add(src, i))) }
+ *   ->
+ *   mcopy(dst, src, or(and(add(n, 31), not(31)), mul(gt(n, not(31)), not(31))))
+ *
+ * Loads from calldata become ``calldatacopy(dst, src, ...)`` and storing zero becomes
+ * ``calldatacopy(dst, calldatasize(), ...)``. Memory to memory copies are only replaced
+ * if ``mcopy`` is available and copying forwards word by word is known to have the same
+ * result as ``mcopy``, i.e. if ``dst`` is the same as ``src``, both are constants with
+ * ``dst <= src`` or both are constants and the areas do not overlap.
+ *
+ * The loop has to consist of exactly the store in the body and the increment in the
+ * post block, the counter has to be declared with the value zero right before the loop
+ * and must not be used after it. ``dst``, ``src`` and ``n`` can be variables or literals.
+ *
+ * The length is ``n`` rounded up to a multiple of 32. The second operand of the ``or``
+ * prevents it from wrapping to zero for an ``n`` close to 2**256, where the loop runs
+ * out of gas, so that the copy runs out of gas as well. For a literal ``n`` the length
+ * is computed at compile time.
+ *
+ * Prerequisite: Disambiguator, ForLoopInitRewriter.
+ */
+class LoopIdiomRecogniser: public ASTModifier
+{
+public:
+	static constexpr char const* name{"LoopIdiomRecogniser"};
+	static void run(OptimiserStepContext& _context, Block& _ast);
+
+	using ASTModifier::operator();
+	void operator()(Block& _block) override;
+
+private:
+	LoopIdiomRecogniser(Dialect const& _dialect, std::map<YulName, Expression const*> const& _ssaValues):
+		m_dialect(_dialect),
+		m_ssaValues(_ssaValues),
+		m_analysis(_dialect)
+	{}
+
+	/// @returns the bulk copy replacing the loop at @a _loopIndex, if it is a copy or fill loop.
+	std::optional<Statement> replaceLoop(std::vector<Statement> const& _statements, size_t _loopIndex);
+
+	/// @returns true if @a _expression is a call to the builtin @a _name with @a _arguments arguments.
+	bool isBuiltinCall(Expression const& _expression, std::string_view _name, size_t _arguments) const;
+	/// @returns @a x if @a _expression is ``add(x, _counter)`` or ``add(_counter, x)`` and
+	/// @a x is a literal or a variable other than @a _counter.
+	Expression const* offsetBase(Expression const& _expression, YulName _counter) const;
+	/// @returns the value of a literal or of an SSA variable with a literal value.
+	std::optional<u256> constantValue(Expression const& _expression) const;
+
+	Expression builtinCall(
+		langutil::DebugData::ConstPtr const& _debugData,
+		std::string_view _name,
+		std::vector<Expression> _arguments
+	) const;
+
+	Dialect const& m_dialect;
+	std::map<YulName, Expression const*> const& m_ssaValues;
+	LoopUnrollingAnalysis m_analysis;
+};
+
+}
@@ -41,7 +41,13 @@ void LoopUnrolling::run(OptimiserStepContext& _context, Block& _ast)
 	std::set<YulName> ssaVars = SSAValueTracker::ssaVariables(_ast);
 	
 	// Create the analyzer with the current context
-	LoopUnrollingAnalysis analyzer{_context.dialect};
+	// Loops are weighted by the configured runs, also in creation code. If there is a profile,
+	// it scales them down for loops that are rarely executed, like the ones in creation code.
+	LoopUnrollingAnalysis analyzer{
+		_context.dialect,
+		_context.configuredExecutionsPerDeployment,
+		_context.executionProfile
+	};
 	
 	// Run the transformation
 	LoopUnrolling{_context.dialect, ssaVars, std::move(analyzer)}(_ast);
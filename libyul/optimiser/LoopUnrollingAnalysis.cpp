@@ -78,8 +78,10 @@ UnrollDecision LoopUnrollingAnalysis::analyzeLoop(
 	}
 	
 	// Step 4: Gas-based cost-benefit analysis for full unrolling
-	// Use estimated runs of 200 as default if not available (typical for deployed contracts)
-	size_t estimatedRuns = 200;
+	// Hot loops (according to the recorded profile, if any) justify more code than cold ones.
+	size_t estimatedRuns = m_estimatedRuns;
+	if (m_executionProfile && _loop.debugData)
+		estimatedRuns = m_executionProfile->weightedRuns(_loop.debugData->originLocation, m_estimatedRuns);
 	if (!shouldFullyUnroll(_loop, inductionVar, iterCount.value(), estimatedRuns))
 	{
 		decision.reason = "Gas cost-benefit analysis suggests no unrolling";
@@ -101,31 +103,16 @@ std::optional<std::tuple<YulName, bool, u256>> LoopUnrollingAnalysis::extractInd
 	size_t _loopIndex
 )
 {
-	std::cerr << "DEBUG: extractInductionVariable called" << std::endl;
-	
 	// Step 1: Find the induction variable from the loop condition
 	// Must have a condition
 	if (!_loop.condition)
-	{
-		std::cerr << "DEBUG: No condition" << std::endl;
 		return std::nullopt;
-	}
-	
-	std::cerr << "DEBUG: Condition expression index: " << _loop.condition->index() << std::endl;
 	
 	// Condition must be a function call (comparison)
 	auto const* condCall = std::get_if<FunctionCall>(_loop.condition.get());
-	if (!condCall)
-	{
-		std::cerr << "DEBUG: Condition is not a FunctionCall (might be Identifier or Literal)" << std::endl;
-		// TODO: Handle case where condition is an Identifier (variable holding the condition result)
+	// TODO: Handle case where condition is an Identifier (variable holding the condition result)
+	if (!condCall || condCall->arguments.size() != 2)
 		return std::nullopt;
-	}
-	if (condCall->arguments.size() != 2)
-	{
-		std::cerr << "DEBUG: Wrong argument count: " << condCall->arguments.size() << std::endl;
-		return std::nullopt;
-	}
 	
 	// Extract function name
 	std::string condOp;
@@ -141,14 +128,18 @@ std::optional<std::tuple<YulName, bool, u256>> LoopUnrollingAnalysis::extractInd
 		return std::nullopt;
 	
 	// Find which argument is the induction variable (identifier)
-	// The other must be a literal (the bound)
+	// The other is the bound: a literal, or a variable if the induction variable comes first
+	// (only loops with a literal bound have a predictable iteration count)
 	YulName inductionVar;
 	bool varIsFirstArg = false;
 	
-	// Check if first arg is variable, second is literal
+	// Check if first arg is variable, second is literal or variable
 	if (auto const* ident = std::get_if<Identifier>(&condCall->arguments[0]))
 	{
-		if (std::holds_alternative<Literal>(condCall->arguments[1]))
+		if (
+			std::holds_alternative<Literal>(condCall->arguments[1]) ||
+			std::holds_alternative<Identifier>(condCall->arguments[1])
+		)
 		{
 			inductionVar = ident->name;
 			varIsFirstArg = true;
@@ -171,10 +162,6 @@ std::optional<std::tuple<YulName, bool, u256>> LoopUnrollingAnalysis::extractInd
 	// First check the loop's PRE block (most common case for for-loops)
 	std::optional<u256> initValue;
 	
-	std::cerr << "DEBUG: Looking for induction var: " << inductionVar.str() << std::endl;
-	std::cerr << "DEBUG: PRE block has " << _loop.pre.statements.size() << " statements" << std::endl;
-	std::cerr << "DEBUG: _blockStatements has " << _blockStatements.size() << " statements, loopIndex=" << _loopIndex << std::endl;
-	
 	for (auto const& stmt : _loop.pre.statements)
 	{
 		// Check for variable declaration: let i := <literal>
@@ -187,7 +174,6 @@ std::optional<std::tuple<YulName, bool, u256>> LoopUnrollingAnalysis::extractInd
 					if (auto const* lit = std::get_if<Literal>(varDecl->value.get()))
 					{
 						initValue = lit->value.value();
-						std::cout << "DEBUG: Found initValue = " << initValue.value() << " in VarDecl\n";
 						break;
 					}
 				}
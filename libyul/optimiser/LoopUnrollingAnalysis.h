@@ -20,6 +20,8 @@
 #include <libyul/AST.h>
 #include <libyul/YulName.h>
 
+#include <liblangutil/ExecutionProfile.h>
+
 #include <optional>
 #include <set>
 #include <string>
@@ -53,8 +55,16 @@ struct UnrollDecision
 class LoopUnrollingAnalysis
 {
 public:
-	explicit LoopUnrollingAnalysis(Dialect const& _dialect):
-		m_dialect(_dialect)
+	/// @param _estimatedRuns Estimated number of times the code will run after deployment
+	/// @param _executionProfile Optional recorded execution counts used to weight @a _estimatedRuns per loop
+	explicit LoopUnrollingAnalysis(
+		Dialect const& _dialect,
+		size_t _estimatedRuns = 200,
+		langutil::ExecutionProfile const* _executionProfile = nullptr
+	):
+		m_dialect(_dialect),
+		m_estimatedRuns(_estimatedRuns),
+		m_executionProfile(_executionProfile)
 	{ }
 
 	/// Analyzes a loop and returns a decision on whether to unroll it.
@@ -139,6 +149,8 @@ private:
 	);
 
 	Dialect const& m_dialect;
+	size_t m_estimatedRuns;
+	langutil::ExecutionProfile const* m_executionProfile;
 	
 	// Tuning parameters - these control the aggressiveness of unrolling
 	static constexpr size_t MAX_CONTRACT_SIZE = 24576;  // Ethereum max contract size in bytes (EIP-170)
@@ -24,6 +24,11 @@
 #include <string>
 #include <set>
 
+namespace solidity::langutil
+{
+class ExecutionProfile;
+}
+
 namespace solidity::yul
 {
 
@@ -38,6 +43,12 @@ struct OptimiserStepContext
 	std::set<YulName> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Recorded execution counts, if available. Steps that trade code size for gas can use it
+	/// to weight @a expectedExecutionsPerDeployment by how hot a piece of code actually is.
+	langutil::ExecutionProfile const* executionProfile = nullptr;
+	/// The number of runs the optimiser is configured with. Unlike @a expectedExecutionsPerDeployment,
+	/// it is also set for creation code. Defaults to the default of the compiler.
+	size_t configuredExecutionsPerDeployment = 200;
 };
 
 
@@ -0,0 +1,142 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimisation stage that merges consecutive sstore operations to the same slot.
+ */
+
+#include <libyul/optimiser/StorageWriteCoalescer.h>
+
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/OptimizerUtilities.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/AST.h>
+#include <libyul/Utilities.h>
+
+#include <libsolutil/CommonData.h>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+void StorageWriteCoalescer::run(OptimiserStepContext const& _context, Block& _ast)
+{
+	StorageWriteCoalescer coalescer{
+		_context.dialect,
+		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+	};
+	coalescer(_ast);
+
+	StatementRemover remover{coalescer.m_pendingRemovals};
+	remover(_ast);
+}
+
+void StorageWriteCoalescer::operator()(FunctionDefinition& _functionDefinition)
+{
+	ScopedSaveAndRestore pendingStores(m_pendingStores, {});
+	DataFlowAnalyzer::operator()(_functionDefinition);
+}
+
+void StorageWriteCoalescer::operator()(ForLoop& _forLoop)
+{
+	// Stores before the loop can be observed in any iteration and stores inside
+	// the loop can be observed by the next iteration.
+	clearPendingStores();
+	DataFlowAnalyzer::operator()(_forLoop);
+	clearPendingStores();
+}
+
+void StorageWriteCoalescer::operator()(Block& _block)
+{
+	m_pendingStores.emplace_back();
+	DataFlowAnalyzer::operator()(_block);
+	m_pendingStores.pop_back();
+}
+
+void StorageWriteCoalescer::visit(Statement& _statement)
+{
+	if (
+		std::holds_alternative<Leave>(_statement) ||
+		std::holds_alternative<Break>(_statement) ||
+		std::holds_alternative<Continue>(_statement)
+	)
+		clearPendingStores();
+
+	std::optional<std::pair<YulName, YulName>> store;
+	if (ExpressionStatement const* expression = std::get_if<ExpressionStatement>(&_statement))
+		store = isSimpleStore(StoreLoadLocation::Storage, *expression);
+
+	// The arguments of a simple store are identifiers, so nothing can be observed
+	// between the previous store and this one after this check.
+	if (store && !m_pendingStores.empty())
+		if (PendingStore const* previous = valueOrNullptr(m_pendingStores.back(), store->first))
+			if (storageValue(store->first) == previous->value)
+				m_pendingRemovals.insert(previous->statement);
+
+	DataFlowAnalyzer::visit(_statement);
+
+	if (store && !m_pendingStores.empty())
+		m_pendingStores.back()[store->first] = PendingStore{&_statement, store->second};
+}
+
+void StorageWriteCoalescer::visit(Expression& _expression)
+{
+	DataFlowAnalyzer::visit(_expression);
+
+	if (std::optional<YulName> key = isSimpleLoad(StoreLoadLocation::Storage, _expression))
+		if (std::optional<YulName> value = storageValue(*key))
+			if (inScope(*value))
+			{
+				_expression = Identifier{debugDataOf(_expression), *value};
+				return;
+			}
+
+	if (FunctionCall const* functionCall = std::get_if<FunctionCall>(&_expression))
+		if (observesStorage(*functionCall))
+			clearPendingStores();
+}
+
+void StorageWriteCoalescer::clearPendingStores()
+{
+	for (auto& pendingStores: m_pendingStores)
+		pendingStores.clear();
+}
+
+bool StorageWriteCoalescer::observesStorage(FunctionCall const& _functionCall) const
+{
+	if (BuiltinFunction const* builtin = resolveBuiltinFunction(_functionCall.functionName, m_dialect))
+	{
+		if (
+			std::holds_alternative<BuiltinName>(_functionCall.functionName) &&
+			std::get<BuiltinName>(_functionCall.functionName).handle == m_dialect.storageStoreFunctionHandle()
+		)
+			return false;
+		return builtin->sideEffects.storage != SideEffects::None || builtin->controlFlowSideEffects.canTerminate;
+	}
+
+	yulAssert(std::holds_alternative<Identifier>(_functionCall.functionName));
+	YulName functionName = std::get<Identifier>(_functionCall.functionName).name;
+	SideEffects const* sideEffects = valueOrNullptr(m_functionSideEffects, FunctionHandle{functionName});
+	ControlFlowSideEffects const* controlFlowSideEffects = valueOrNullptr(m_controlFlowSideEffects, functionName);
+	return
+		!sideEffects ||
+		!controlFlowSideEffects ||
+		sideEffects->storage != SideEffects::None ||
+		controlFlowSideEffects->canTerminate;
+}
@@ -0,0 +1,98 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Optimisation stage that merges consecutive sstore operations to the same slot.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/ControlFlowSideEffects.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Optimisation stage that merges consecutive sstore operations to the same slot.
+ *
+ * Writes to members of a packed storage slot are read-modify-write sequences:
+ *
+ *   sstore(k, or(and(sload(k), m1), a))
+ *   sstore(k, or(and(sload(k), m2), b))
+ *
+ * The step replaces ``sload(k)`` by the value that is known to be stored at ``k`` and
+ * removes an ``sstore(k, v)`` if it is followed by another ``sstore(k, w)`` in the same
+ * block while ``v`` is still known to be the value at ``k``, so that only the last
+ * write of the combined value remains. A store is only removed if nothing in between can
+ * observe it: no remaining storage read, no call that reads storage and no
+ * successful termination. Reverts are fine, since they undo the store anyway.
+ * Stores are never combined across loops or ``leave``, ``break`` and ``continue``.
+ *
+ * Works best if the code is in SSA form - without literal arguments.
+ *
+ * Prerequisite: Disambiguator, ForLoopInitRewriter.
+ */
+class StorageWriteCoalescer: public DataFlowAnalyzer
+{
+public:
+	static constexpr char const* name{"StorageWriteCoalescer"};
+	static void run(OptimiserStepContext const&, Block& _ast);
+
+	using DataFlowAnalyzer::operator();
+	void operator()(FunctionDefinition& _functionDefinition) override;
+	void operator()(ForLoop& _forLoop) override;
+	void operator()(Block& _block) override;
+
+private:
+	StorageWriteCoalescer(
+		Dialect const& _dialect,
+		std::map<FunctionHandle, SideEffects> _functionSideEffects,
+		std::map<YulName, ControlFlowSideEffects> _controlFlowSideEffects
+	):
+		DataFlowAnalyzer(_dialect, MemoryAndStorage::Analyze, std::move(_functionSideEffects)),
+		m_controlFlowSideEffects(std::move(_controlFlowSideEffects))
+	{}
+
+	using ASTModifier::visit;
+	void visit(Statement& _statement) override;
+	void visit(Expression& _expression) override;
+
+	/// @returns true if the call can read a storage value or end the execution successfully,
+	/// i.e. if it can observe a pending store.
+	bool observesStorage(FunctionCall const& _functionCall) const;
+	void clearPendingStores();
+
+	struct PendingStore
+	{
+		Statement const* statement = nullptr;
+		YulName value;
+	};
+
+	/// Not yet observed stores of the current block and all enclosing blocks,
+	/// by the slot variable.
+	std::vector<std::map<YulName, PendingStore>> m_pendingStores;
+	std::map<YulName, ControlFlowSideEffects> m_controlFlowSideEffects;
+	std::set<Statement const*> m_pendingRemovals;
+};
+
+}
@@ -37,6 +37,7 @@
 #include <libyul/optimiser/ExpressionSplitter.h>
 #include <libyul/optimiser/ExpressionJoiner.h>
 #include <libyul/optimiser/ExpressionInliner.h>
+#include <libyul/optimiser/FreeMemoryPointerRewinder.h>
 #include <libyul/optimiser/FullInliner.h>
 #include <libyul/optimiser/ForLoopConditionIntoBody.h>
 #include <libyul/optimiser/ForLoopConditionOutOfBody.h>
@@ -53,12 +54,14 @@
 #include <libyul/optimiser/SSATransform.h>
 #include <libyul/optimiser/StackCompressor.h>
 #include <libyul/optimiser/StackLimitEvader.h>
+#include <libyul/optimiser/StorageWriteCoalescer.h>
 #include <libyul/optimiser/StructuralSimplifier.h>
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/UnusedAssignEliminator.h>
 #include <libyul/optimiser/UnusedStoreEliminator.h>
 #include <libyul/optimiser/VarNameCleaner.h>
 #include <libyul/optimiser/LoadResolver.h>
+#include <libyul/optimiser/LoopIdiomRecogniser.h>
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/LoopUnrolling.h>
 #include <libyul/optimiser/Metrics.h>
@@ -96,7 +99,9 @@ void OptimiserSuite::run(
 	std::string_view _optimisationSequence,
 	std::string_view _optimisationCleanupSequence,
 	std::optional<size_t> _expectedExecutionsPerDeployment,
-	std::set<YulName> const& _externallyUsedIdentifiers
+	size_t _configuredExecutionsPerDeployment,
+	std::set<YulName> const& _externallyUsedIdentifiers,
+	langutil::ExecutionProfile const* _executionProfile
 )
 {
 	yulAssert(_object.dialect());
@@ -120,7 +125,14 @@ void OptimiserSuite::run(
 	}
 
 	NameDispenser dispenser{dialect, astRoot, reservedIdentifiers};
-	OptimiserStepContext context{dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
+	OptimiserStepContext context{
+		dialect,
+		dispenser,
+		reservedIdentifiers,
+		_expectedExecutionsPerDeployment,
+		_executionProfile,
+		_configuredExecutionsPerDeployment
+	};
 
 	OptimiserSuite suite(context, Debug::None);
 
@@ -247,12 +259,14 @@ std::map<std::string, std::unique_ptr<OptimiserStep>> const& OptimiserSuite::all
 			ForLoopConditionIntoBody,
 			ForLoopConditionOutOfBody,
 			ForLoopInitRewriter,
+			FreeMemoryPointerRewinder,
 			FullInliner,
 			FunctionGrouper,
 			FunctionHoister,
 			FunctionSpecializer,
 			LiteralRematerialiser,
 			LoadResolver,
+			LoopIdiomRecogniser,
 			LoopInvariantCodeMotion,
 			LoopUnrolling,
 			UnusedAssignEliminator,
@@ -260,6 +274,7 @@ std::map<std::string, std::unique_ptr<OptimiserStep>> const& OptimiserSuite::all
 			Rematerialiser,
 			SSAReverser,
 			SSATransform,
+			StorageWriteCoalescer,
 			StructuralSimplifier,
 			UnusedFunctionParameterPruner,
 			UnusedPruner,
@@ -289,12 +304,14 @@ std::map<std::string, char> const& OptimiserSuite::stepNameToAbbreviationMap()
 		{ForLoopConditionIntoBody::name,      'I'},
 		{ForLoopConditionOutOfBody::name,     'O'},
 		{ForLoopInitRewriter::name,           'o'},
+		{FreeMemoryPointerRewinder::name,     'P'},
 		{FullInliner::name,                   'i'},
 		{FunctionGrouper::name,               'g'},
 		{FunctionHoister::name,               'h'},
 		{FunctionSpecializer::name,           'F'},
 		{LiteralRematerialiser::name,         'T'},
 		{LoadResolver::name,                  'L'},
+		{LoopIdiomRecogniser::name,           'B'},
 		{LoopInvariantCodeMotion::name,       'M'},
 		{LoopUnrolling::name,                 'R'},
 		{UnusedAssignEliminator::name,        'r'},
@@ -302,6 +319,7 @@ std::map<std::string, char> const& OptimiserSuite::stepNameToAbbreviationMap()
 		{Rematerialiser::name,                'm'},
 		{SSAReverser::name,                   'V'},
 		{SSATransform::name,                  'a'},
+		{StorageWriteCoalescer::name,         'W'},
 		{StructuralSimplifier::name,          't'},
 		{UnusedFunctionParameterPruner::name, 'p'},
 		{UnusedPruner::name,                  'u'},
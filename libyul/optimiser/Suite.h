@@ -62,6 +62,7 @@ public:
 	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
+	/// `_configuredExecutionsPerDeployment` is the configured number of runs, also for creation code.
 	static void run(
 		GasMeter const* _meter,
 		Object& _object,
@@ -69,7 +70,9 @@ public:
 		std::string_view _optimisationSequence,
 		std::string_view _optimisationCleanupSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulName> const& _externallyUsedIdentifiers = {}
+		size_t _configuredExecutionsPerDeployment,
+		std::set<YulName> const& _externallyUsedIdentifiers = {},
+		langutil::ExecutionProfile const* _executionProfile = nullptr
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -840,7 +840,11 @@ void CommandLineInterface::processInput()
 		solAssert(m_standardJsonInput.has_value());
 
 		StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
-		sout() << compiler.compile(std::move(m_standardJsonInput.value())) << std::endl;
+		if (m_options.output.streamStandardJson)
+			compiler.compile(m_standardJsonInput.value(), sout());
+		else
+			sout() << compiler.compile(std::move(m_standardJsonInput.value()));
+		sout() << std::endl;
 		m_standardJsonInput.reset();
 		break;
 	}
@@ -938,6 +942,7 @@ void CommandLineInterface::compile()
 		m_compiler->setViaIR(m_options.output.viaIR);
 		m_compiler->setEVMVersion(m_options.output.evmVersion);
 		m_compiler->setEOFVersion(m_options.output.eofVersion);
+		m_compiler->setAnalysisThreads(m_options.output.analysisThreads);
 		m_compiler->setRevertStringBehaviour(m_options.output.revertStrings);
 		if (m_options.output.debugInfoSelection.has_value())
 			m_compiler->selectDebugInfo(m_options.output.debugInfoSelection.value());
@@ -972,6 +977,14 @@ void CommandLineInterface::compile()
 				m_options.compiler.combinedJsonRequests->funDebug ||
 				m_options.compiler.combinedJsonRequests->funDebugRuntime
 			));
+		pipelineConfig.debugData =
+			m_options.compiler.estimateGas ||
+			m_options.compiler.outputs.ethdebug ||
+			m_options.compiler.outputs.ethdebugRuntime ||
+			(m_options.compiler.combinedJsonRequests && (
+				m_options.compiler.combinedJsonRequests->funDebug ||
+				m_options.compiler.combinedJsonRequests->funDebugRuntime
+			));
 
 		m_compiler->selectContracts({{"", {{"", pipelineConfig}}}});
 
@@ -24,6 +24,8 @@
 
 #include <liblangutil/EVMVersion.h>
 
+#include <libsolutil/CommonIO.h>
+
 #include <boost/algorithm/string.hpp>
 
 #include <range/v3/view/transform.hpp>
@@ -41,6 +43,7 @@ namespace solidity::frontend
 {
 
 static std::string const g_strAllowPaths = "allow-paths";
+static std::string const g_strAnalysisThreads = "analysis-threads";
 static std::string const g_strBasePath = "base-path";
 static std::string const g_strIncludePath = "include-path";
 static std::string const g_strAssemble = "assemble";
@@ -87,6 +90,8 @@ static std::string const g_strOptimize = "optimize";
 static std::string const g_strOptimizeRuns = "optimize-runs";
 static std::string const g_strOptimizeYul = "optimize-yul";
 static std::string const g_strYulOptimizations = "yul-optimizations";
+static std::string const g_strDispatcherSelectorOrder = "dispatcher-selector-order";
+static std::string const g_strProfileData = "profile-data";
 static std::string const g_strOutputDir = "output-dir";
 static std::string const g_strOverwrite = "overwrite";
 static std::string const g_strRevertStrings = "revert-strings";
@@ -102,6 +107,7 @@ static std::set<std::string> const g_revertStringsArgs
 };
 
 static std::string const g_strStandardJSON = "standard-json";
+static std::string const g_strStreamStandardJSON = "stream-standard-json";
 static std::string const g_strStrictAssembly = "strict-assembly";
 static std::string const g_strSwarm = "swarm";
 static std::string const g_strPrettyJson = "pretty-json";
@@ -236,6 +242,8 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		output.debugInfoSelection == _other.output.debugInfoSelection &&
 		output.stopAfter == _other.output.stopAfter &&
 		output.eofVersion == _other.output.eofVersion &&
+		output.analysisThreads == _other.output.analysisThreads &&
+		output.streamStandardJson == _other.output.streamStandardJson &&
 		input.mode == _other.input.mode &&
 		assembly.targetMachine == _other.assembly.targetMachine &&
 		assembly.inputLanguage == _other.assembly.inputLanguage &&
@@ -253,6 +261,8 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		optimizer.optimizeYul == _other.optimizer.optimizeYul &&
 		optimizer.expectedExecutionsPerDeployment == _other.optimizer.expectedExecutionsPerDeployment &&
 		optimizer.yulSteps == _other.optimizer.yulSteps &&
+		optimizer.dispatcherSelectorOrder == _other.optimizer.dispatcherSelectorOrder &&
+		optimizer.executionProfile == _other.optimizer.executionProfile &&
 		modelChecker.initialize == _other.modelChecker.initialize &&
 		modelChecker.settings == _other.modelChecker.settings;
 }
@@ -290,6 +300,9 @@ OptimiserSettings CommandLineOptions::optimiserSettings() const
 			solAssert(settings.yulOptimiserCleanupSteps == OptimiserSettings::DefaultYulOptimiserCleanupSteps);
 	}
 
+	settings.dispatcherSelectorOrder = optimizer.dispatcherSelectorOrder;
+	settings.executionProfile = optimizer.executionProfile;
+
 	return settings;
 }
 
@@ -659,6 +672,20 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("stage"),
 			"Stop execution after the given compiler stage. Valid options: \"parsing\"."
 		)
+		(
+			g_strAnalysisThreads.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Type check and statically analyse independent source units, and estimate the gas "
+			"of independent functions, on up to n threads. "
+			"The output does not depend on the number of threads."
+		)
+		(
+			g_strStreamStandardJSON.c_str(),
+			("Write the output of --" + g_strStandardJSON + " while it is assembled, one contract at a time. "
+			"Reduces the memory usage for large projects. The output has the same members, but \"errors\" "
+			"comes last, so that an error while generating an artifact can be reported after the "
+			"artifacts written before it.").c_str()
+		)
 	;
 	desc.add(outputOptions);
 
@@ -857,6 +884,19 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("steps"),
 			"Forces Yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
 		)
+		(
+			g_strDispatcherSelectorOrder.c_str(),
+			po::value<std::string>()->value_name("selector,selector,..."),
+			"Comma-separated list of function selectors (8 hex digits each) that the external function "
+			"dispatcher checks first and in the given order. Only affects the IR-based code generator."
+		)
+		(
+			g_strProfileData.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"JSON file with recorded call counts per function selector and execution counts per "
+			"source range. The optimizer favours gas over code size for the code that is executed "
+			"most and uses the call counts to order the external function dispatcher."
+		)
 	;
 	desc.add(optimizerOptions);
 
@@ -1031,6 +1071,8 @@ void CommandLineParser::processArgs()
 		// TODO: This should eventually contain all options.
 		{g_strExperimentalViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strAnalysisThreads, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strStreamStandardJSON, {InputMode::StandardJson}},
 		{g_strMetadataLiteral, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strNoCBORMetadata, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strMetadataHash, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -1119,7 +1161,14 @@ void CommandLineParser::processArgs()
 				"Option --" + g_strOptimizeRuns + " is only valid in compiler and assembler modes."
 			);
 
-		for (std::string const& option: {g_strOptimize, g_strNoOptimizeYul, g_strOptimizeYul, g_strYulOptimizations})
+		for (std::string const& option: {
+			g_strOptimize,
+			g_strNoOptimizeYul,
+			g_strOptimizeYul,
+			g_strYulOptimizations,
+			g_strDispatcherSelectorOrder,
+			g_strProfileData
+		})
 			if (m_args.count(option) > 0)
 				solThrow(
 					CommandLineValidationError,
@@ -1222,6 +1271,15 @@ void CommandLineParser::processArgs()
 			m_options.output.stopAfter = CompilerStack::State::Parsed;
 	}
 
+	if (m_args.count(g_strAnalysisThreads) && !m_args[g_strAnalysisThreads].defaulted())
+	{
+		if (m_args[g_strAnalysisThreads].as<unsigned>() == 0)
+			solThrow(CommandLineValidationError, "--" + g_strAnalysisThreads + " must be at least 1.");
+		m_options.output.analysisThreads = m_args[g_strAnalysisThreads].as<unsigned>();
+	}
+
+	m_options.output.streamStandardJson = (m_args.count(g_strStreamStandardJSON) > 0);
+
 	parseInputPathsAndRemappings();
 
 	if (m_options.input.mode == InputMode::StandardJson)
@@ -1297,6 +1355,55 @@ void CommandLineParser::processArgs()
 		m_options.optimizer.yulSteps = m_args[g_strYulOptimizations].as<std::string>();
 	}
 
+	if (m_args.count(g_strDispatcherSelectorOrder))
+	{
+		std::vector<std::string> selectors;
+		boost::split(selectors, m_args[g_strDispatcherSelectorOrder].as<std::string>(), boost::is_any_of(","));
+		for (std::string const& selector: selectors)
+		{
+			if (selector.size() != 8 || !std::all_of(selector.begin(), selector.end(), boost::is_xdigit()))
+				solThrow(
+					CommandLineValidationError,
+					"Invalid function selector in --" + g_strDispatcherSelectorOrder + ": \"" + selector + "\". "
+					"Expected 8 hexadecimal digits."
+				);
+			m_options.optimizer.dispatcherSelectorOrder.emplace_back(
+				static_cast<uint32_t>(std::stoul(selector, nullptr, 16))
+			);
+		}
+	}
+
+	if (m_args.count(g_strProfileData))
+	{
+		std::string const path = m_args[g_strProfileData].as<std::string>();
+		std::string data;
+		try
+		{
+			data = util::readFileAsString(path);
+		}
+		catch (util::FileNotFound const&)
+		{
+			solThrow(CommandLineValidationError, "Profile data file not found: \"" + path + "\".");
+		}
+		catch (util::NotAFile const&)
+		{
+			solThrow(CommandLineValidationError, "Profile data path is not a file: \"" + path + "\".");
+		}
+
+		Json profileJson;
+		std::string errors;
+		if (!util::jsonParseStrict(data, profileJson, &errors))
+			solThrow(CommandLineValidationError, "Invalid JSON in profile data: " + errors);
+		try
+		{
+			m_options.optimizer.executionProfile = ExecutionProfile::fromJson(profileJson);
+		}
+		catch (ProfileDataError const& _error)
+		{
+			solThrow(CommandLineValidationError, std::string("Invalid profile data: ") + _error.what());
+		}
+	}
+
 	if (m_options.input.mode == InputMode::Assembler)
 	{
 		std::vector<std::string> const nonAssemblyModeOptions = {
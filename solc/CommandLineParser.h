@@ -29,6 +29,7 @@
 
 #include <liblangutil/DebugInfoSelection.h>
 #include <liblangutil/EVMVersion.h>
+#include <liblangutil/ExecutionProfile.h>
 
 #include <libsolutil/JSON.h>
 
@@ -198,6 +199,8 @@ struct CommandLineOptions
 		std::optional<langutil::DebugInfoSelection> debugInfoSelection;
 		CompilerStack::State stopAfter = CompilerStack::State::CompilationSuccessful;
 		std::optional<uint8_t> eofVersion;
+		size_t analysisThreads = 1;
+		bool streamStandardJson = false;
 	} output;
 
 	struct
@@ -238,6 +241,8 @@ struct CommandLineOptions
 		bool optimizeYul = false;
 		std::optional<unsigned> expectedExecutionsPerDeployment;
 		std::optional<std::string> yulSteps;
+		std::vector<uint32_t> dispatcherSelectorOrder;
+		langutil::ExecutionProfile executionProfile;
 	} optimizer;
 
 	struct
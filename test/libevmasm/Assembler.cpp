@@ -454,6 +454,33 @@ BOOST_AUTO_TEST_CASE(ethdebug_program_last_instruction_with_immediate_arguments)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(assemble_without_debug_data, *boost::unit_test::precondition(nonEOF()))
+{
+	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	Assembly assembly{evmVersion, true, {}, {}};
+	std::shared_ptr<Assembly> subAsmPtr = std::make_shared<Assembly>(evmVersion, false, std::nullopt, std::string{});
+	subAsmPtr->append(subAsmPtr->namedTag("sub_function", 0, 0, {}));
+	subAsmPtr->append(Instruction::STOP);
+	assembly.append(assembly.namedTag("function", 1, 2, 3));
+	assembly.append(u256(1));
+	assembly.appendSubroutine(subAsmPtr);
+
+	LinkerObject const withoutDebugData = assembly.assemble(false);
+	BOOST_CHECK(withoutDebugData.functionDebugData.empty());
+	BOOST_CHECK(withoutDebugData.codeSectionLocations.empty());
+	BOOST_CHECK(subAsmPtr->assemble(false).functionDebugData.empty());
+
+	// Requesting the debug data assembles the objects again.
+	LinkerObject const withDebugData = assembly.assemble();
+	BOOST_CHECK(withDebugData.bytecode == withoutDebugData.bytecode);
+	BOOST_CHECK(withDebugData.functionDebugData.count("function") == 1);
+	BOOST_REQUIRE(withDebugData.codeSectionLocations.size() == 1);
+	BOOST_CHECK(withDebugData.codeSectionLocations[0].instructionLocations.size() == 3);
+	BOOST_CHECK(subAsmPtr->assemble().functionDebugData.count("sub_function") == 1);
+	// Objects assembled with the debug data are also returned if it is not needed.
+	BOOST_CHECK(assembly.assemble(false).functionDebugData.count("function") == 1);
+}
+
 BOOST_AUTO_TEST_CASE(ethdebug_resources)
 {
 	Json const resources = ethdebug::resources({"sourceA", "sourceB"}, "version1");
@@ -30,6 +30,7 @@
 #include <libevmasm/ControlFlowGraph.h>
 #include <libevmasm/BlockDeduplicator.h>
 #include <libevmasm/Assembly.h>
+#include <libevmasm/ConstantOptimiser.h>
 
 #include <boost/test/unit_test.hpp>
 
@@ -2224,6 +2225,53 @@ BOOST_AUTO_TEST_CASE(inliner_invalid)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(constant_optimiser_cache)
+{
+	// The representations of constants are shared between all assemblies of the process.
+	// Optimising for one EVM version must not change the results for another one.
+	std::vector<u256> const values{
+		u256(0xffff) << 240,
+		(u256(1) << 255) - 0x1234,
+		u256("0x12345678000000000000000000000000000000000000000000000000000000ff"),
+		~(u256(0xabcdef) << 100)
+	};
+	auto optimise = [&](EVMVersion _evmVersion, bool _isCreation) {
+		Assembly assembly{_evmVersion, _isCreation, std::nullopt, {}};
+		for (u256 const& value: values)
+			assembly.append(value);
+		ConstantOptimisationMethod::optimiseConstants(
+			_isCreation,
+			_isCreation ? 1 : Assembly::OptimiserSettings{}.expectedExecutionsPerDeployment,
+			_evmVersion,
+			assembly
+		);
+		return assembly.codeSections().at(0).items;
+	};
+
+	std::vector<EVMVersion> const evmVersions{
+		EVMVersion::homestead(),
+		EVMVersion::constantinople(),
+		EVMVersion::shanghai(),
+		EVMVersion::current()
+	};
+	for (bool isCreation: {false, true})
+	{
+		std::vector<AssemblyItems> firstResults;
+		for (EVMVersion const& evmVersion: evmVersions)
+			firstResults.emplace_back(optimise(evmVersion, isCreation));
+		for (size_t i = evmVersions.size(); i-- > 0;)
+		{
+			AssemblyItems const cachedResult = optimise(evmVersions[i], isCreation);
+			BOOST_CHECK_EQUAL_COLLECTIONS(
+				cachedResult.begin(), cachedResult.end(),
+				firstResults[i].begin(), firstResults[i].end()
+			);
+			for (AssemblyItem const& item: cachedResult)
+				if (item.type() == Operation)
+					BOOST_CHECK(evmVersions[i].hasOpcode(item.instruction(), std::nullopt));
+		}
+	}
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 
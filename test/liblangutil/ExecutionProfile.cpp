@@ -0,0 +1,118 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the ExecutionProfile class.
+ */
+
+#include <liblangutil/ExecutionProfile.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <fmt/format.h>
+
+namespace solidity::langutil::test
+{
+
+namespace
+{
+
+ExecutionProfile parse(std::string const& _json)
+{
+	Json json;
+	BOOST_REQUIRE(util::jsonParseStrict(_json, json));
+	return ExecutionProfile::fromJson(json);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ExecutionProfileTest)
+
+BOOST_AUTO_TEST_CASE(parse_and_print)
+{
+	ExecutionProfile profile = parse(R"({
+		"selectors": {"a9059cbb": 1500, "70A08231": 300},
+		"sourceLocations": [{"source": "a.sol", "start": 10, "end": 20, "count": 7}]
+	})");
+	BOOST_CHECK(!profile.empty());
+	BOOST_CHECK_EQUAL(profile.selectorCounts().at(0xa9059cbb), 1500);
+	BOOST_CHECK_EQUAL(profile.selectorCounts().at(0x70a08231), 300);
+	BOOST_CHECK(ExecutionProfile::fromJson(profile.toJson()) == profile);
+
+	BOOST_CHECK(parse("{}").empty());
+}
+
+BOOST_AUTO_TEST_CASE(invalid)
+{
+	BOOST_CHECK_THROW(parse("[]"), ProfileDataError);
+	BOOST_CHECK_THROW(parse(R"({"unknown": 1})"), ProfileDataError);
+	BOOST_CHECK_THROW(parse(R"({"selectors": {"a9059cb": 1}})"), ProfileDataError);
+	BOOST_CHECK_THROW(parse(R"({"selectors": {"a9059cbg": 1}})"), ProfileDataError);
+	BOOST_CHECK_THROW(parse(R"({"selectors": {"a9059cbb": -1}})"), ProfileDataError);
+	BOOST_CHECK_THROW(parse(R"({"sourceLocations": [{"source": "a.sol", "start": 1, "count": 1}]})"), ProfileDataError);
+	BOOST_CHECK_THROW(parse(R"({"sourceLocations": [{"source": "a.sol", "start": 5, "end": 1, "count": 1}]})"), ProfileDataError);
+}
+
+BOOST_AUTO_TEST_CASE(dispatch_order)
+{
+	// Few selectors: Ordering all of them by frequency is best.
+	ExecutionProfile profile = parse(R"({"selectors": {"00000001": 900, "00000002": 60, "00000003": 30, "00000004": 10}})");
+	BOOST_CHECK((profile.dispatchOrder({1, 2, 3, 4}) == std::vector<uint32_t>{1, 2, 3, 4}));
+	// Selectors not part of the contract are ignored.
+	BOOST_CHECK((profile.dispatchOrder({3, 4, 5}) == std::vector<uint32_t>{3, 4}));
+	BOOST_CHECK(profile.dispatchOrder({5, 6}).empty());
+
+	// Many selectors: Only the dominant one is worth an extra check in front of the binary search.
+	Json json;
+	json["selectors"]["00000001"] = 900;
+	std::set<uint32_t> selectors{1};
+	for (uint32_t selector = 2; selector <= 16; ++selector)
+	{
+		json["selectors"][fmt::format("{:08x}", selector)] = 10;
+		selectors.insert(selector);
+	}
+	BOOST_CHECK((ExecutionProfile::fromJson(json).dispatchOrder(selectors) == std::vector<uint32_t>{1}));
+
+	ExecutionProfile uniform = parse(R"({"selectors": {"00000001": 5, "00000002": 5, "00000003": 5, "00000004": 5}})");
+	BOOST_CHECK(uniform.dispatchOrder({1, 2, 3, 4}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(weighted_runs)
+{
+	ExecutionProfile profile = parse(R"({"sourceLocations": [
+		{"source": "a.sol", "start": 0, "end": 100, "count": 10},
+		{"source": "a.sol", "start": 20, "end": 40, "count": 50},
+		{"source": "a.sol", "start": 60, "end": 70, "count": 0}
+	]})");
+	auto const source = std::make_shared<std::string>("a.sol");
+	auto const otherSource = std::make_shared<std::string>("b.sol");
+
+	// The mean count is 20, the innermost containing range applies.
+	BOOST_CHECK_EQUAL(profile.weightedRuns(SourceLocation{25, 30, source}, 200), 500);
+	BOOST_CHECK_EQUAL(profile.weightedRuns(SourceLocation{5, 30, source}, 200), 100);
+	// Never executed code still counts as executed once.
+	BOOST_CHECK_EQUAL(profile.weightedRuns(SourceLocation{61, 62, source}, 200), 1);
+	BOOST_CHECK_EQUAL(profile.weightedRuns(SourceLocation{90, 110, source}, 200), 200);
+	BOOST_CHECK_EQUAL(profile.weightedRuns(SourceLocation{25, 30, otherSource}, 200), 200);
+	BOOST_CHECK_EQUAL(profile.weightedRuns(SourceLocation{}, 200), 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -572,6 +572,33 @@ BOOST_AUTO_TEST_CASE(comments_mixed_in_sequence)
 	BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), "documentation comment ");
 }
 
+BOOST_AUTO_TEST_CASE(long_comments_and_literals)
+{
+	std::string const filler(1000, 'x');
+	std::string hexBytes;
+	for (size_t i = 0; i < 500; ++i)
+		hexBytes += "ab";
+	TestScanner scanner(
+		"/*" + filler + "*/ a" + filler + " //" + filler + "\n"
+		"\"" + filler + "\" hex\"" + hexBytes + "\" ///" + filler + "\n;"
+	);
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLocation().start, 1005);
+	BOOST_CHECK_EQUAL(scanner.currentLocation().end, 2006);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "a" + filler);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::StringLiteral);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), filler);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::HexStringLiteral);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), std::string(500, '\xab'));
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Semicolon);
+	BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), filler);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+
+	scanner.reset("/*" + filler + "\xE2\x80\xAC*/");
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+	BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::DirectionalOverrideUnderflow);
+}
+
 BOOST_AUTO_TEST_CASE(ether_subdenominations)
 {
 	TestScanner scanner("wei gwei ether");
@@ -40,9 +40,10 @@ namespace solidity::frontend::test
 class GasMeterTestFramework: public SolidityExecutionFramework
 {
 public:
-	void compile(std::string const& _sourceCode)
+	void compile(std::string const& _sourceCode, CompilerStack::ContractSelection const& _selectedContracts = {})
 	{
 		m_compiler.reset();
+		m_compiler.selectContracts(_selectedContracts);
 		m_compiler.setSources({{"", "pragma solidity >=0.0;\n"
 				"// SPDX-License-Identifier: GPL-3.0\n" + _sourceCode}});
 		m_compiler.setOptimiserSettings(solidity::test::CommonOptions::get().optimize);
@@ -296,6 +297,44 @@ BOOST_AUTO_TEST_CASE(regular_functions_exclude_fallback)
 	testRunTimeGas("x()", std::vector<bytes>{encodeArgs()});
 }
 
+BOOST_AUTO_TEST_CASE(loop_with_constant_bound)
+{
+	// The iterations of loops that only depend on constants are followed one by one.
+	char const* sourceCode = R"(
+		contract test {
+			function f() public pure returns (uint r) {
+				unchecked {
+					for (uint i = 0; i < 10; i++)
+						r += i;
+				}
+			}
+		}
+	)";
+	testCreationTimeGas(sourceCode);
+	testRunTimeGas("f()", std::vector<bytes>{encodeArgs()});
+}
+
+BOOST_AUTO_TEST_CASE(estimates_without_selected_debug_data)
+{
+	// The function debug data is assembled on demand if only the bytecode was selected.
+	char const* sourceCode = R"(
+		contract test {
+			uint x;
+			function f(uint a) public { g(a); }
+			function g(uint a) internal { x = a; }
+		}
+	)";
+	compile(sourceCode);
+	Json estimates = m_compiler.gasEstimates(m_compiler.lastContractName());
+	BOOST_REQUIRE(estimates.contains("internal"));
+	BOOST_CHECK(estimates["internal"]["g(uint256)"] != "infinite");
+
+	CompilerStack::PipelineConfig bytecodeOnly;
+	bytecodeOnly.bytecode = true;
+	compile(sourceCode, {{"", {{"", bytecodeOnly}}}});
+	BOOST_CHECK_EQUAL(m_compiler.gasEstimates(m_compiler.lastContractName()), estimates);
+}
+
 BOOST_AUTO_TEST_CASE(complex_control_flow)
 {
 	// This crashed the gas estimator previously (or took a very long time).
@@ -25,6 +25,7 @@
 #include <test/Common.h>
 
 #include <liblangutil/Exceptions.h>
+#include <liblangutil/SourceReferenceFormatter.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/ImportRemapper.h>
 
@@ -112,6 +113,50 @@ BOOST_AUTO_TEST_CASE(context_dependent_remappings_order_independent_2)
 	BOOST_CHECK(c.compile());
 }
 
+BOOST_AUTO_TEST_CASE(parallel_analysis)
+{
+	auto analyze = [](StringMap const& _sources, size_t _threads) {
+		CompilerStack c;
+		c.setSources(_sources);
+		c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		c.setAnalysisThreads(_threads);
+		c.parseAndAnalyze();
+		return langutil::SourceReferenceFormatter::formatErrorInformation(c.errors(), c, false, true);
+	};
+
+	// Every source uses the contract of the previous one and has a warning of the static analyzer.
+	StringMap sources;
+	for (size_t i = 0; i < 8; ++i)
+		sources["s" + std::to_string(i) + ".sol"] =
+			(i > 0 ? "import \"s" + std::to_string(i - 1) + ".sol\"; " : "") +
+			"contract C" + std::to_string(i) + " { function f(uint x) public returns (uint) { uint unused; " +
+			(i > 0 ? "new C" + std::to_string(i - 1) + "(); " : "") +
+			"return x; } } pragma solidity >=0.0;";
+	std::string const warnings = analyze(sources, 1);
+	BOOST_CHECK(warnings.find("Unused local variable") != std::string::npos);
+	BOOST_CHECK_EQUAL(analyze(sources, 4), warnings);
+
+	// Type errors in several sources are reported in source order.
+	sources["s2.sol"] = "contract C2 { function f() public { uint8 x = 300; } } pragma solidity >=0.0;";
+	sources["s5.sol"] = "contract C5 { function f() public { bool x = 1; } } pragma solidity >=0.0;";
+	sources["s6.sol"] = "contract C6 { function f() public { uint x = 1 / 0; } } pragma solidity >=0.0;";
+	std::string const errors = analyze(sources, 1);
+	BOOST_CHECK(errors.find("TypeError") != std::string::npos);
+	BOOST_CHECK_EQUAL(analyze(sources, 4), errors);
+
+	// Inline assembly in several sources uses a constant whose type is only known after the
+	// source defining it was type checked.
+	sources = {
+		{"a.sol", "uint constant X = 1 + 2; pragma solidity >=0.0;"},
+		{"b.sol", "import \"a.sol\"; contract B { function f() public pure returns (uint r) { assembly { r := X } } } pragma solidity >=0.0;"},
+		{"c.sol", "import \"a.sol\"; contract C { function f() public pure returns (uint r) { assembly { r := X } } } pragma solidity >=0.0;"},
+		{"d.sol", "import \"a.sol\"; import \"b.sol\"; import \"c.sol\"; contract D is B { function g() public pure returns (uint r) { assembly { r := X } } } pragma solidity >=0.0;"},
+	};
+	BOOST_CHECK_EQUAL(analyze(sources, 1), "");
+	for (size_t i = 0; i < 10; ++i)
+		BOOST_CHECK_EQUAL(analyze(sources, 4), "");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -35,6 +35,7 @@
 
 #include <algorithm>
 #include <set>
+#include <sstream>
 #include <utility>
 
 using namespace solidity::evmasm;
@@ -1349,6 +1350,58 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].get<unsigned>() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_dispatcher_selector_order)
+{
+	auto compileWithOrder = [](std::string const& _dispatcherSelectorOrder) {
+		std::string input = R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"viaIR": true,
+				"outputSelection": {
+					"fileA": { "A": [ "ir", "metadata" ] }
+				},
+				"optimizer": { "details": { "dispatcherSelectorOrder": )" + _dispatcherSelectorOrder + R"( } }
+			},
+			"sources": {
+				"fileA": {
+					"content": "contract A { function approve(address, uint256) external {} function totalSupply() external {} function balanceOf(address) external {} function transfer(address, uint256) external {} }"
+				}
+			}
+		}
+		)";
+		return compile(input);
+	};
+
+	// approve: 0x095ea7b3, totalSupply: 0x18160ddd, balanceOf: 0x70a08231, transfer: 0xa9059cbb
+	Json result = compileWithOrder(R"(["a9059cbb", "70A08231", "12345678"])");
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json contract = getContractResult(result, "fileA", "A");
+	BOOST_REQUIRE(contract["ir"].is_string());
+	std::string const& ir = contract["ir"].get<std::string>();
+	size_t const transfer = ir.find("case 0xa9059cbb");
+	size_t const balanceOf = ir.find("case 0x70a08231");
+	size_t const approve = ir.find("case 0x095ea7b3");
+	size_t const totalSupply = ir.find("case 0x18160ddd");
+	BOOST_CHECK(transfer < balanceOf);
+	BOOST_CHECK(balanceOf < approve);
+	BOOST_CHECK(approve < totalSupply);
+	BOOST_CHECK(totalSupply != std::string::npos);
+
+	Json metadata;
+	BOOST_REQUIRE(util::jsonParseStrict(contract["metadata"].get<std::string>(), metadata));
+	BOOST_CHECK_EQUAL(
+		metadata["settings"]["optimizer"]["details"]["dispatcherSelectorOrder"],
+		Json::parse(R"(["a9059cbb", "70a08231", "12345678"])")
+	);
+
+	std::string const expectedErrorMessage =
+		"\"settings.optimizer.details.dispatcherSelectorOrder\" must be an array of function selectors, "
+		"each given as a string of 8 hexadecimal digits.";
+	for (std::string const invalidOrder: {R"("a9059cbb")", R"(["a9059cb"])", R"(["0xa9059c"])", R"([2835717307])"})
+		BOOST_CHECK(containsError(compileWithOrder(invalidOrder), "JSONError", expectedErrorMessage));
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
@@ -1870,6 +1923,41 @@ BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract_yul)
 	BOOST_REQUIRE(result["sources"].size() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(ir_independent_of_other_contracts)
+{
+	// Both contracts request the same require helpers, whose parameter names are taken from
+	// the arguments of the call.
+	auto compileIR = [](std::string const& _selectedContract) {
+		std::string input = R"(
+		{
+			"language": "Solidity",
+			"sources": {
+				"A.sol": {
+					"content": "error E(uint256); contract C { function f(uint256 a) public pure { require(a > 1, \"too small\"); require(a > 2, E(a)); } } contract D { function g(uint256 b) public pure { require(b > 1, \"too small\"); require(b > 2, E(b)); } }"
+				}
+			},
+			"settings": {
+				"outputSelection": {
+					"A.sol": {
+						")" + _selectedContract + R"(": ["ir"]
+					}
+				}
+			}
+		}
+		)";
+
+		Json parsedInput;
+		BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+		solidity::frontend::StandardCompiler compiler;
+		Json result = compiler.compile(parsedInput);
+		BOOST_REQUIRE(result["contracts"]["A.sol"]["D"]["ir"].is_string());
+		return result["contracts"]["A.sol"]["D"]["ir"].get<std::string>();
+	};
+
+	BOOST_CHECK_EQUAL(compileIR("D"), compileIR("*"));
+}
+
 BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 {
 	char const* input = R"(
@@ -1907,6 +1995,92 @@ BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 	BOOST_REQUIRE(sourceMap.find(sourceRef) != std::string::npos);
 }
 
+BOOST_AUTO_TEST_CASE(streamed_output)
+{
+	// "A.sol2:B" comes before "A.sol:A", but "A.sol" before "A.sol2".
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "//SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\ninterface I { function f() external; }\ncontract A is I { function f() public { uint x; } }"
+			},
+			"A.sol2": {
+				"content": "//SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\nimport \"A.sol\";\ncontract B { function g() public returns (A) { return new A(); } }"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"*": {
+					"*": ["*", "evm.gasEstimates"],
+					"": ["ast"]
+				}
+			}
+		}
+	}
+	)";
+
+	for (util::JsonFormat const& format: {util::JsonFormat{}, util::JsonFormat{util::JsonFormat::Pretty}})
+		for (std::string const& source: {std::string(input), std::string("{\"language\": \"Solidity\", \"sources\": {"), std::string("{}")})
+		{
+			std::stringstream streamedOutput;
+			frontend::StandardCompiler(ReadCallback::Callback{}, format).compile(source, streamedOutput);
+			std::string const output = frontend::StandardCompiler(ReadCallback::Callback{}, format).compile(source);
+			// The members are the same, but "errors" comes last.
+			BOOST_CHECK_EQUAL(Json::parse(streamedOutput.str()), Json::parse(output));
+			nlohmann::ordered_json const streamedJson = nlohmann::ordered_json::parse(streamedOutput.str());
+			if (streamedJson.contains("errors"))
+				BOOST_CHECK_EQUAL(std::prev(streamedJson.end()).key(), "errors");
+			else
+				BOOST_CHECK_EQUAL(streamedOutput.str(), output);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(streamed_output_failure)
+{
+	// JSON strings cannot contain the invalid UTF-8 in the documentation, so the contract and the
+	// AST cannot be written. Natspec and the AST are generated without compiling the contract.
+	std::string const input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {"urls": ["A.sol"]}
+		},
+		"settings": {
+			"outputSelection": {
+				"*": {
+					"*": ["abi", "userdoc"],
+					"": ["ast"]
+				}
+			}
+		}
+	}
+	)";
+	ReadCallback::Callback readCallback = [](std::string const&, std::string const&) {
+		return ReadCallback::Result{
+			true,
+			"//SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\ncontract A {\n\t/// @notice \xff\n\tfunction f() public pure {}\n}\ncontract B {}\n"
+		};
+	};
+
+	Json const output = Json::parse(frontend::StandardCompiler(readCallback).compile(input));
+	BOOST_REQUIRE(output.contains("errors"));
+	BOOST_CHECK_EQUAL(output["errors"][0]["message"], "Error writing output JSON.");
+
+	std::stringstream streamedOutput;
+	frontend::StandardCompiler(readCallback).compile(input, streamedOutput);
+	nlohmann::ordered_json const streamedJson = nlohmann::ordered_json::parse(streamedOutput.str());
+	BOOST_REQUIRE(streamedJson.contains("errors"));
+	BOOST_CHECK_EQUAL(std::prev(streamedJson.end()).key(), "errors");
+	// Contract A cannot be written, but B comes afterwards and is not written either.
+	BOOST_CHECK(streamedJson["contracts"]["A.sol"]["A"].is_null());
+	BOOST_CHECK(!streamedJson["contracts"]["A.sol"].contains("B"));
+	BOOST_CHECK(!streamedJson["sources"]["A.sol"].contains("id"));
+	BOOST_REQUIRE_EQUAL(streamedJson["errors"].size(), 2);
+	for (auto const& error: streamedJson["errors"])
+		BOOST_CHECK_EQUAL(error["severity"], "error");
+}
+
 BOOST_AUTO_TEST_CASE(ethdebug_excluded_from_wildcards)
 {
 	frontend::StandardCompiler compiler;
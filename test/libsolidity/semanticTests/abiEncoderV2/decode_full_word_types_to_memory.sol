@@ -0,0 +1,29 @@
+pragma abicoder v2;
+
+contract C {
+    struct S { uint256 a; bytes32 b; int256 c; }
+    function f(uint256[] memory a) external pure returns (uint256, uint256, uint256) {
+        return (a.length, a[0], a[a.length - 1]);
+    }
+    function g(bytes32[3] memory a) external pure returns (bytes32, bytes32, bytes32) {
+        return (a[0], a[1], a[2]);
+    }
+    function h(S memory s) external pure returns (uint256, bytes32, int256) {
+        return (s.a, s.b, s.c);
+    }
+    function i(S[] memory s) external pure returns (uint256, uint256, int256) {
+        return (s.length, s[0].a, s[1].c);
+    }
+    function j(bytes memory data) external pure returns (uint256, uint256) {
+        uint256[] memory a = abi.decode(data, (uint256[]));
+        return (a.length, a[1]);
+    }
+}
+// ----
+// f(uint256[]): 0x20, 3, 1, 2, 3 -> 3, 1, 3
+// f(uint256[]): 0x20, 3, 1, 2 -> FAILURE
+// g(bytes32[3]): 1, 2, 3 -> 1, 2, 3
+// g(bytes32[3]): 1, 2 -> FAILURE
+// h((uint256,bytes32,int256)): 7, 8, -1 -> 7, 8, -1
+// i((uint256,bytes32,int256)[]): 0x20, 2, 1, 2, 3, 4, 5, 6 -> 2, 1, 6
+// j(bytes): 0x20, 0x80, 0x20, 2, 5, 6 -> 2, 6
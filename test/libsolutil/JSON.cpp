@@ -26,6 +26,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 
 namespace solidity::util::test
 {
@@ -117,6 +119,46 @@ BOOST_AUTO_TEST_CASE(json_compact_print)
 	BOOST_CHECK(R"({"1":1,"2":"2","3":{"3.1":"3.1","3.2":2},"4":"\u0911 \u0912 \u0913 \u0914 \u0915 \u0916","5":"\u0010","6":"\u4e2d"})" == jsonCompactPrint(json));
 }
 
+BOOST_AUTO_TEST_CASE(json_stream_writer)
+{
+	Json json;
+	json["a"] = Json::array();
+	json["b"] = {{"x", "\u4e2d"}, {"y", Json::array({1, Json::object(), Json::array()})}};
+	json["c"] = Json::array({Json{{"z", true}}, "s"});
+	json["d"] = Json::object();
+
+	for (auto format: {JsonFormat{JsonFormat::Compact}, JsonFormat{JsonFormat::Pretty}, JsonFormat{JsonFormat::Pretty, 4}})
+	{
+		std::stringstream output;
+		JsonStreamWriter writer(output, format);
+		writer.beginObject();
+		writer.key("a");
+		writer.beginArray();
+		writer.endArray();
+		writer.key("b");
+		writer.value(json["b"]);
+		writer.key("c");
+		writer.beginArray();
+		writer.beginObject();
+		writer.key("z");
+		writer.value(true);
+		writer.endObject();
+		writer.value("s");
+		writer.endArray();
+		writer.key("d");
+		writer.beginObject();
+		writer.endObject();
+		writer.endObject();
+		BOOST_CHECK_EQUAL(output.str(), jsonPrint(json, format));
+	}
+
+	std::stringstream output;
+	JsonStreamWriter writer(output, JsonFormat{JsonFormat::Compact});
+	writer.beginObject();
+	BOOST_CHECK_THROW(writer.value(1), Exception);
+	BOOST_CHECK_THROW(writer.endArray(), Exception);
+}
+
 BOOST_AUTO_TEST_CASE(parse_json_strict)
 {
 	// In this test we check conformance against JSON.parse (https://tc39.es/ecma262/multipage/structured-data.html#sec-json.parse)
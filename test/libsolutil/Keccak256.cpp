@@ -68,6 +68,29 @@ BOOST_AUTO_TEST_CASE(strings)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(incremental)
+{
+	BOOST_CHECK_EQUAL(Keccak256Hasher{}.hash(), keccak256(bytes()));
+
+	// Long enough to span several blocks of the sponge.
+	std::string input;
+	for (size_t i = 0; i < 1000; ++i)
+		input += static_cast<char>('a' + i % 26);
+	for (size_t chunkSize: std::vector<size_t>{1, 7, 135, 136, 137, 500})
+	{
+		Keccak256Hasher hasher;
+		for (size_t offset = 0; offset < input.size(); offset += chunkSize)
+			hasher.update(std::string_view(input).substr(offset, chunkSize));
+		BOOST_CHECK_EQUAL(hasher.hash(), keccak256(input));
+	}
+
+	Keccak256Hasher hasher;
+	hasher.update("longer test");
+	BOOST_CHECK_EQUAL(hasher.hash(), keccak256("longer test"));
+	hasher.update(" string");
+	BOOST_CHECK_EQUAL(hasher.hash(), keccak256("longer test string"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -95,6 +95,27 @@ BOOST_AUTO_TEST_CASE(encode_signed)
 	BOOST_REQUIRE(negative_larger[5] == 0x7C);
 }
 
+BOOST_AUTO_TEST_CASE(decode_unsigned)
+{
+	for (uint64_t value: {uint64_t(0), uint64_t(1), uint64_t(0x7f), uint64_t(0x80), uint64_t(624485), ~uint64_t(0)})
+	{
+		bytes encoded = solidity::util::lebEncode(value);
+		encoded.emplace_back(0xff);
+		size_t offset = 0;
+		BOOST_REQUIRE(solidity::util::lebDecode(bytesConstRef(&encoded), offset) == value);
+		BOOST_REQUIRE(offset == encoded.size() - 1);
+	}
+
+	size_t offset = 0;
+	bytes truncated{0xE5, 0x8E};
+	BOOST_REQUIRE(!solidity::util::lebDecode(bytesConstRef(&truncated), offset));
+
+	offset = 0;
+	bytes tooLarge(9, 0xff);
+	tooLarge.emplace_back(0x02);
+	BOOST_REQUIRE(!solidity::util::lebDecode(bytesConstRef(&tooLarge), offset));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
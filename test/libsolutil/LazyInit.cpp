@@ -20,7 +20,10 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace solidity::util::test
 {
@@ -114,6 +117,29 @@ BOOST_AUTO_TEST_CASE(move_constructed_has_same_value_as_original)
 	BOOST_CHECK_EQUAL(valueOf(std::move(moveConstructed)), 12);
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_init_runs_once)
+{
+	LazyInit<int> lazyInit;
+	std::atomic<int> initCalls = 0;
+	std::atomic<int> wrongValues = 0;
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < 8; ++i)
+		threads.emplace_back([&]{
+			int value = lazyInit.init([&]{
+				++initCalls;
+				return 12;
+			});
+			if (value != 12)
+				++wrongValues;
+		});
+	for (std::thread& thread: threads)
+		thread.join();
+
+	BOOST_CHECK_EQUAL(initCalls, 1);
+	BOOST_CHECK_EQUAL(wrongValues, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
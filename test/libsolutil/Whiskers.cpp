@@ -240,6 +240,22 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(template_reuse)
+{
+	// The parsed template is shared, the parameters are not.
+	std::string templ = "<?c><a><!c>-</c><#l><x></l>";
+	std::vector<std::map<std::string, std::string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	Whiskers m1(templ);
+	m1("c", true)("a", "A")("l", list);
+	Whiskers m2(templ);
+	m2("c", false)("a", "B")("l", std::vector<Whiskers::StringMap>{});
+	BOOST_CHECK_EQUAL(m1.render(), "A12");
+	BOOST_CHECK_EQUAL(m2.render(), "-");
+	BOOST_CHECK_EQUAL(m1.render(), "A12");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
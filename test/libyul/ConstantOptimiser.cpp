@@ -0,0 +1,138 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the representations shared between runs of the constant optimiser.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/backends/evm/ConstantOptimiser.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/// Replaces number literals like ConstantOptimiser, but searches every representation from scratch.
+class UncachedConstantOptimiser: public ASTModifier
+{
+public:
+	UncachedConstantOptimiser(EVMDialect const& _dialect, GasMeter const& _meter):
+		m_dialect(_dialect),
+		m_meter(_meter)
+	{}
+
+	void visit(Expression& _e) override
+	{
+		if (Literal const* literal = std::get_if<Literal>(&_e))
+		{
+			if (literal->kind != LiteralKind::Number)
+				return;
+			std::map<u256, ConstantOptimiser::Representation> cache;
+			if (
+				Expression const* representation =
+					RepresentationFinder(m_dialect, m_meter, DebugData::create(), cache)
+					.tryFindRepresentation(literal->value.value())
+			)
+				_e = ASTCopier{}.translate(*representation);
+		}
+		else
+			ASTModifier::visit(_e);
+	}
+
+private:
+	EVMDialect const& m_dialect;
+	GasMeter const& m_meter;
+};
+
+std::string optimise(EVMVersion _evmVersion, std::optional<uint8_t> _eofVersion, bool _isCreation, bool _cached)
+{
+	YulStack stack(
+		_evmVersion,
+		_eofVersion,
+		YulStack::Language::StrictAssembly,
+		frontend::OptimiserSettings::none(),
+		DebugInfoSelection::None()
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("", R"({
+		sstore(0, 0xffff000000000000000000000000000000000000000000000000000000000000)
+		sstore(1, 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffedcb)
+		sstore(2, 0x12345678000000000000000000000000000000000000000000000000000000ff)
+		sstore(3, 0xfffffffffffffffffffffffffffffffffffffff543210fffffffffffffffffff)
+	})"));
+	Object const& object = *stack.parserResult();
+	EVMDialect const& dialect = dynamic_cast<EVMDialect const&>(*object.dialect());
+	Block block = std::get<Block>(ASTCopier{}(object.code()->root()));
+	GasMeter meter(dialect, _isCreation, frontend::OptimiserSettings{}.expectedExecutionsPerDeployment);
+	if (_cached)
+		ConstantOptimiser{dialect, meter}(block);
+	else
+		UncachedConstantOptimiser{dialect, meter}(block);
+	return AsmPrinter::format(AST(dialect, std::move(block)), {}, DebugInfoSelection::None());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulConstantOptimiser)
+
+BOOST_AUTO_TEST_CASE(cached_and_uncached_representations)
+{
+	// The representations are shared between all runs of the optimiser in the process.
+	// The results must be the same as without sharing, whatever was optimised before.
+	std::vector<std::pair<EVMVersion, std::optional<uint8_t>>> versions{
+		{EVMVersion::homestead(), std::nullopt},
+		{EVMVersion::constantinople(), std::nullopt},
+		{EVMVersion::shanghai(), std::nullopt},
+		{EVMVersion::current(), std::nullopt},
+	};
+	for (std::optional<uint8_t> eofVersion: EVMVersion::allEOFVersions())
+		if (eofVersion)
+			versions.emplace_back(EVMVersion::firstWithEOF(), eofVersion);
+
+	for (bool isCreation: {false, true})
+	{
+		for (auto const& [evmVersion, eofVersion]: versions)
+			BOOST_CHECK_EQUAL(
+				optimise(evmVersion, eofVersion, isCreation, true),
+				optimise(evmVersion, eofVersion, isCreation, false)
+			);
+		for (size_t i = versions.size(); i-- > 0;)
+			BOOST_CHECK_EQUAL(
+				optimise(versions[i].first, versions[i].second, isCreation, true),
+				optimise(versions[i].first, versions[i].second, isCreation, false)
+			);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,197 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the paged memory of the Yul interpreter.
+ */
+
+#include <test/tools/yulInterpreter/Memory.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+#include <map>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+u256 const maxAddress = std::numeric_limits<u256>::max();
+size_t const pageSize = InterpreterMemory::pageSize;
+
+/// The byte-wise memory model the interpreter used before the pages were introduced.
+class ReferenceMemory
+{
+public:
+	void write(u256 const& _offset, bytes const& _data)
+	{
+		for (size_t i = 0; i < _data.size(); ++i)
+			m_bytes[_offset + i] = _data[i];
+	}
+	bytes read(u256 const& _offset, size_t _size) const
+	{
+		bytes data(_size, 0);
+		for (size_t i = 0; i < _size; ++i)
+			if (auto it = m_bytes.find(_offset + i); it != m_bytes.end())
+				data[i] = it->second;
+		return data;
+	}
+
+private:
+	std::map<u256, uint8_t> m_bytes;
+};
+
+bytes sequence(size_t _size, uint8_t _first)
+{
+	bytes data(_size);
+	for (size_t i = 0; i < _size; ++i)
+		data[i] = static_cast<uint8_t>(_first + i);
+	return data;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulInterpreterMemory)
+
+BOOST_AUTO_TEST_CASE(unwritten_memory)
+{
+	InterpreterMemory memory;
+	BOOST_CHECK(memory.empty());
+	BOOST_CHECK_EQUAL(memory.get(0), 0);
+	BOOST_CHECK_EQUAL(memory.get(maxAddress), 0);
+	BOOST_CHECK_EQUAL(memory.readWord(12345), 0);
+	BOOST_CHECK(memory.read(maxAddress - 7, 100) == bytes(100, 0));
+	// Reading does not allocate pages.
+	BOOST_CHECK(memory.empty());
+}
+
+BOOST_AUTO_TEST_CASE(sparse_accesses)
+{
+	InterpreterMemory memory;
+	u256 const far = u256(1) << 200;
+	memory.set(3, 0x11);
+	memory.set(far + 5, 0x22);
+	memory.writeWord(maxAddress - 31, 0x1234);
+
+	BOOST_CHECK_EQUAL(memory.pages().size(), 3);
+	BOOST_CHECK(memory.pages().count(0));
+	BOOST_CHECK(memory.pages().count(far));
+	BOOST_CHECK(memory.pages().count(maxAddress - (pageSize - 1)));
+
+	BOOST_CHECK_EQUAL(memory.get(3), 0x11);
+	BOOST_CHECK_EQUAL(memory.get(4), 0);
+	BOOST_CHECK_EQUAL(memory.get(far + 5), 0x22);
+	BOOST_CHECK_EQUAL(memory.get(far + 4), 0);
+	BOOST_CHECK_EQUAL(memory.readWord(maxAddress - 31), 0x1234);
+	BOOST_CHECK_EQUAL(memory.get(maxAddress - 1), 0x12);
+	BOOST_CHECK_EQUAL(memory.get(maxAddress), 0x34);
+	// Bytes between the written ones are not affected.
+	BOOST_CHECK(memory.read(far - 16, 21) == bytes(21, 0));
+
+	memory.clear();
+	BOOST_CHECK(memory.empty());
+	BOOST_CHECK_EQUAL(memory.get(3), 0);
+}
+
+BOOST_AUTO_TEST_CASE(growth_across_pages)
+{
+	InterpreterMemory memory;
+	bytes const data = sequence(pageSize + 10, 1);
+	memory.write(pageSize - 5, data.data(), data.size());
+
+	// The write touches the end of the first, the whole second and the start of the third page.
+	BOOST_CHECK_EQUAL(memory.pages().size(), 3);
+	BOOST_CHECK(memory.read(pageSize - 5, data.size()) == data);
+	BOOST_CHECK_EQUAL(memory.get(pageSize - 6), 0);
+	BOOST_CHECK_EQUAL(memory.get(2 * pageSize + 5), 0);
+	BOOST_CHECK_EQUAL(memory.get(2 * pageSize + 4), data.back());
+
+	// A word that crosses a page boundary.
+	memory.writeWord(3 * pageSize - 16, maxAddress);
+	BOOST_CHECK_EQUAL(memory.pages().size(), 4);
+	BOOST_CHECK_EQUAL(memory.readWord(3 * pageSize - 16), maxAddress);
+	BOOST_CHECK_EQUAL(memory.readWord(3 * pageSize - 15), maxAddress - 0xff);
+}
+
+BOOST_AUTO_TEST_CASE(wrap_around)
+{
+	InterpreterMemory memory;
+	u256 const value = (u256(0xaabbccdd) << 224) | 0x11223344;
+	memory.writeWord(maxAddress - 3, value);
+
+	// The first four bytes end up at the top of the address space, the rest at the bottom.
+	BOOST_CHECK_EQUAL(memory.pages().size(), 2);
+	BOOST_CHECK_EQUAL(memory.get(maxAddress - 3), 0xaa);
+	BOOST_CHECK_EQUAL(memory.get(maxAddress), 0xdd);
+	BOOST_CHECK_EQUAL(memory.get(0), 0);
+	BOOST_CHECK_EQUAL(memory.get(27), 0x44);
+	BOOST_CHECK_EQUAL(memory.readWord(maxAddress - 3), value);
+	BOOST_CHECK(memory.read(24, 4) == bytes({0x11, 0x22, 0x33, 0x44}));
+
+	memory.fill(maxAddress - 1, 26);
+	BOOST_CHECK(memory.read(maxAddress - 3, 32) == bytes({0xaa, 0xbb}) + bytes(26, 0) + bytes({0x11, 0x22, 0x33, 0x44}));
+}
+
+BOOST_AUTO_TEST_CASE(fill_does_not_allocate)
+{
+	InterpreterMemory memory;
+	memory.fill(0, 10 * pageSize);
+	BOOST_CHECK(memory.empty());
+
+	bytes const data = sequence(64, 0x80);
+	memory.write(pageSize * 5 - 32, data.data(), data.size());
+	BOOST_CHECK_EQUAL(memory.pages().size(), 2);
+	memory.fill(pageSize * 5 - 8, pageSize * 3);
+	BOOST_CHECK_EQUAL(memory.pages().size(), 2);
+	BOOST_CHECK(memory.read(pageSize * 5 - 32, 64) == bytes(data.begin(), data.begin() + 24) + bytes(40, 0));
+}
+
+BOOST_AUTO_TEST_CASE(overlapping_accesses)
+{
+	// Overlapping writes, fills and reads of various sizes, some of them crossing page boundaries
+	// or the end of the address space, have to behave exactly like the byte-wise memory.
+	InterpreterMemory memory;
+	ReferenceMemory reference;
+	std::vector<u256> const offsets{0, 1, 17, 31, pageSize - 20, pageSize - 1, 2 * pageSize + 3, maxAddress - 40, maxAddress};
+	std::vector<size_t> const sizes{0, 1, 32, 33, 100, pageSize + 1};
+	uint8_t first = 1;
+	for (u256 const& offset: offsets)
+		for (size_t size: sizes)
+		{
+			bytes const data = sequence(size, first++);
+			memory.write(offset, data.data(), data.size());
+			reference.write(offset, data);
+			if (size % 2)
+			{
+				memory.fill(offset + size / 2, size / 4);
+				reference.write(offset + size / 2, bytes(size / 4, 0));
+			}
+			for (u256 const& readOffset: offsets)
+			{
+				BOOST_REQUIRE(memory.read(readOffset, 2 * pageSize) == reference.read(readOffset, 2 * pageSize));
+				BOOST_REQUIRE(memory.readWord(readOffset + 7) == u256(util::h256(reference.read(readOffset + 7, 32))));
+			}
+		}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
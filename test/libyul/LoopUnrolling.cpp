@@ -0,0 +1,112 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the decisions of the loop unroller that depend on the optimiser settings.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/YulStack.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/ExecutionProfile.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/// Runs only the loop unroller on @a _source and @returns true if the loop is still there.
+bool keepsLoop(std::string const& _source, ExecutionProfile const& _profile, size_t _runs = 200)
+{
+	OptimiserSettings settings = OptimiserSettings::minimal();
+	settings.runYulOptimiser = true;
+	settings.yulOptimiserSteps = "R";
+	settings.yulOptimiserCleanupSteps = "";
+	settings.expectedExecutionsPerDeployment = _runs;
+	settings.executionProfile = _profile;
+
+	YulStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		solidity::test::CommonOptions::get().eofVersion(),
+		YulStack::Language::StrictAssembly,
+		settings,
+		DebugInfoSelection::All()
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("source", _source));
+	stack.optimize();
+	BOOST_REQUIRE(!stack.hasErrors());
+	return stack.print().find("for {") != std::string::npos;
+}
+
+ExecutionProfile profile(uint64_t _loopCount, uint64_t _otherCount)
+{
+	return ExecutionProfile({}, {{"A.sol", {{20, 60, _loopCount}, {0, 100, _otherCount}}}});
+}
+
+// Unrolling the loop saves about 60 gas per run and adds about 4800 gas to the deployment.
+std::string const loopSource = R"(
+	/// @use-src 0:"A.sol"
+	object "A" {
+		code {
+			/// @src 0:0:100
+			let sum := 0
+			/// @src 0:20:60
+			for { let i := 0 } lt(i, 3) { i := add(i, 1) }
+			{
+				sum := add(sum, i)
+			}
+			/// @src 0:0:100
+			sstore(0, sum)
+		}
+	}
+)";
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulLoopUnrolling)
+
+BOOST_AUTO_TEST_CASE(creation_code_without_profile)
+{
+	// Without a profile, the configured runs are used for creation code as well.
+	BOOST_CHECK(!keepsLoop(loopSource, {}));
+	BOOST_CHECK(keepsLoop(loopSource, {}, 1));
+}
+
+BOOST_AUTO_TEST_CASE(profile_changes_unrolling)
+{
+	// The loop is executed rarely compared to the rest of the code, which makes unrolling it too expensive.
+	BOOST_CHECK(keepsLoop(loopSource, profile(1, 1999)));
+	// It is executed often enough to be unrolled even with few runs.
+	BOOST_CHECK(!keepsLoop(loopSource, profile(1999, 1), 50));
+	BOOST_CHECK(keepsLoop(loopSource, {}, 50));
+	// Profile data for other sources has no effect.
+	BOOST_CHECK(!keepsLoop(loopSource, ExecutionProfile({}, {{"B.sol", {{20, 60, 1}, {0, 100, 1999}}}})));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,109 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the binary format of Yul objects.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+#include <libyul/ObjectSerializer.h>
+#include <libyul/YulStack.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+std::string const code = R"(
+	/// @use-src 0:"a.sol", 1:"b.sol"
+	object "O" {
+		code {
+			/// @src 0:10:20
+			function f(a, b) -> c { c := add(a, b) leave }
+			let x := f(calldataload(0), 0x1234)
+			/// @src 1:5:7
+			switch x
+			case 0 { sstore(0, "abc") }
+			default { revert(0, 0) }
+			for { let i := 0 } lt(i, 10) { i := add(i, 1) } { if eq(i, 5) { break } continue }
+			sstore(0, datasize("D"))
+		}
+		object "D" {
+			code { mstore(0, 0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff) }
+			data "j" hex"010203"
+		}
+		data "k" "abc"
+	}
+)";
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulObjectSerializer)
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+	YulStack stack = parseYul(code, "source");
+	BOOST_REQUIRE(stack.parserResult() && !stack.hasErrors());
+	Object const& object = *stack.parserResult();
+
+	bytes const serialized = ObjectSerializer::serialize(object);
+	std::shared_ptr<Object> deserialized = ObjectSerializer::deserialize(bytesConstRef(&serialized), *object.dialect());
+	BOOST_REQUIRE(deserialized);
+	BOOST_CHECK_EQUAL(
+		deserialized->toString(DebugInfoSelection::All(), nullptr),
+		object.toString(DebugInfoSelection::All(), nullptr)
+	);
+	BOOST_CHECK(ObjectSerializer::serialize(*deserialized) == serialized);
+	BOOST_CHECK(nativeLocationOf(deserialized->code()->root().statements.back()) == nativeLocationOf(object.code()->root().statements.back()));
+
+	BOOST_REQUIRE(deserialized->analysisInfo);
+	BOOST_CHECK(deserialized->analysisInfo->scopes.count(&deserialized->code()->root()));
+	BOOST_CHECK_EQUAL(deserialized->analysisInfo->virtualBlocks.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_data)
+{
+	YulStack stack = parseYul(code, "source");
+	BOOST_REQUIRE(stack.parserResult() && !stack.hasErrors());
+	Dialect const& dialect = *stack.parserResult()->dialect();
+	bytes serialized = ObjectSerializer::serialize(*stack.parserResult());
+
+	for (size_t length = 0; length < serialized.size(); ++length)
+		BOOST_CHECK_THROW(ObjectSerializer::deserialize(bytesConstRef(serialized.data(), length), dialect), ObjectFormatError);
+
+	bytes wrongVersion = serialized;
+	wrongVersion[3] = ObjectSerializer::formatVersion + 1;
+	BOOST_CHECK_THROW(ObjectSerializer::deserialize(bytesConstRef(&wrongVersion), dialect), ObjectFormatError);
+
+	serialized.emplace_back(0);
+	BOOST_CHECK_THROW(ObjectSerializer::deserialize(bytesConstRef(&serialized), dialect), ObjectFormatError);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
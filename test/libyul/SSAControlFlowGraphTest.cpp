@@ -51,11 +51,12 @@ std::unique_ptr<TestCase> SSAControlFlowGraphTest::create(TestCase::Config const
 	return std::make_unique<SSAControlFlowGraphTest>(_config.filename);
 }
 
-SSAControlFlowGraphTest::SSAControlFlowGraphTest(std::string const& _filename): TestCase(_filename)
+SSAControlFlowGraphTest::SSAControlFlowGraphTest(std::string const& _filename): EVMVersionRestrictedTestCase(_filename)
 {
 	m_source = m_reader.source();
 	auto dialectName = m_reader.stringSetting("dialect", "evm");
 	soltestAssert(dialectName == "evm"); // We only have one dialect now
+	m_useJumpTables = m_reader.boolSetting("useJumpTables", false);
 	m_expectation = m_reader.simpleExpectations();
 }
 
@@ -74,7 +75,8 @@ TestCase::TestResult SSAControlFlowGraphTest::run(std::ostream& _stream, std::st
 		*yulStack.parserResult()->analysisInfo,
 		yulStack.dialect(),
 		yulStack.parserResult()->code()->root(),
-		true
+		true,
+		m_useJumpTables
 	);
 	ssa::ControlFlowLiveness liveness(*controlFlow);
 	m_obtainedResult = controlFlow->toDot(&liveness);
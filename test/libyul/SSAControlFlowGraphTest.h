@@ -25,12 +25,14 @@
 namespace solidity::yul::test
 {
 
-class SSAControlFlowGraphTest: public solidity::frontend::test::TestCase
+class SSAControlFlowGraphTest: public solidity::frontend::test::EVMVersionRestrictedTestCase
 {
 public:
 	static std::unique_ptr<TestCase> create(Config const& _config);
 	explicit SSAControlFlowGraphTest(std::string const& _filename);
 	TestResult run(std::ostream& _stream, std::string const& _linePrefix = "", bool const _formatted = false) override;
+private:
+	bool m_useJumpTables = false;
 };
 
 }
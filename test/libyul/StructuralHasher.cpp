@@ -0,0 +1,133 @@
+/*
+    This file is part of solidity.
+
+    solidity is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    solidity is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the structural hash of Yul code.
+ */
+
+#include <test/libsolidity/util/SoltestErrors.h>
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+#include <libyul/YulStack.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace solidity::langutil;
+using namespace solidity::util;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/// @returns the code of the object in @a _source printed with all debug info and its hash.
+std::pair<std::string, h256> printAndHash(std::string const& _source)
+{
+	YulStack yulStack = parseYul(_source);
+	soltestAssert(!yulStack.hasErrors());
+	Object const& object = *yulStack.parserResult();
+	return {
+		AsmPrinter::format(*object.code(), object.debugData->sourceNames, DebugInfoSelection::All()),
+		StructuralHasher::run(object.code()->root())
+	};
+}
+
+/// Wraps @a _code into an object whose debug data names the source with index 0.
+std::string withSourceName(std::string const& _code)
+{
+	return "/// @use-src 0:\"a.sol\"\nobject \"a\" { code " + _code + " }";
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulStructuralHasher)
+
+BOOST_AUTO_TEST_CASE(same_code)
+{
+	std::string const source = withSourceName(R"({
+		/// @src 0:10:20
+		let x := calldataload(0)
+		/// @src 0:20:30 @ast-id 7
+		if x { sstore(x, "abc") }
+		switch x case 0 { revert(0, 0) } default { leave_loop() }
+		function leave_loop() { for { } 1 { } { break } }
+	})");
+	BOOST_CHECK(printAndHash(source).second == printAndHash(source).second);
+}
+
+BOOST_AUTO_TEST_CASE(printed_differences)
+{
+	std::vector<std::string> const sources{
+		withSourceName("{ let x := 1 }"),
+		withSourceName("{ let y := 1 }"),
+		withSourceName("{ let x := 0x01 }"),
+		withSourceName("{ let x := \"1\" }"),
+		withSourceName("{ let x := true }"),
+		withSourceName("{ let x, y := f() function f() -> a, b {} }"),
+		withSourceName("{ let x, y := g() function g() -> a, b {} }"),
+		withSourceName("{ let x := 1 let y := 1 }"),
+		withSourceName("{ { let x := 1 } }"),
+		withSourceName("/// @src 0:1:2\n{ let x := 1 }"),
+		withSourceName("/// @src 0:1:3\n{ let x := 1 }"),
+		withSourceName("/// @src 0:1:2\n{ /// @src 0:3:4\nlet x := 1 }"),
+		withSourceName("/// @ast-id 1\n{ let x := 1 }"),
+		withSourceName("/// @ast-id 2\n{ let x := 1 }"),
+	};
+	std::map<h256, std::string> printedByHash;
+	for (std::string const& source: sources)
+	{
+		auto const [printed, hash] = printAndHash(source);
+		BOOST_TEST_INFO(source);
+		BOOST_CHECK(printedByHash.emplace(hash, printed).second);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(identical_prints)
+{
+	// Repeating the current location does not change the printed code, although the parser
+	// creates separate debug data for every node.
+	std::vector<std::pair<std::string, std::string>> const equivalentSources{
+		{
+			withSourceName("/// @src 0:1:2\n{ let x := 1 sstore(x, x) }"),
+			withSourceName("/// @src 0:1:2\n{ /// @src 0:1:2\nlet x := 1 /// @src 0:1:2\nsstore(x, x) }")
+		},
+		{
+			withSourceName("{ let x := 1 }"),
+			withSourceName("{ let x := 1 }  ")
+		},
+	};
+	for (auto const& [first, second]: equivalentSources)
+	{
+		BOOST_TEST_INFO(first + "\n" + second);
+		auto const [firstPrinted, firstHash] = printAndHash(first);
+		auto const [secondPrinted, secondHash] = printAndHash(second);
+		BOOST_REQUIRE_EQUAL(firstPrinted, secondPrinted);
+		BOOST_CHECK(firstHash == secondHash);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -20,6 +20,7 @@
 
 #include <test/libyul/Common.h>
 
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
 #include <test/tools/yulInterpreter/Interpreter.h>
 
 #include <test/Common.h>
@@ -31,6 +32,9 @@
 #include <liblangutil/DebugInfoSelection.h>
 #include <liblangutil/ErrorReporter.h>
 
+#include <libsolutil/AnsiColorized.h>
+#include <libsolutil/StringUtils.h>
+
 #include <boost/test/unit_test.hpp>
 #include <boost/algorithm/string.hpp>
 
@@ -63,12 +67,22 @@ TestCase::TestResult YulInterpreterTest::run(std::ostream& _stream, std::string
 		return TestResult::FatalError;
 	}
 
-	m_obtainedResult = interpret(yulStack.parserResult());
+	m_obtainedResult = interpret(yulStack.parserResult(), /*_compiled=*/ false);
+
+	// Both execution engines have to behave identically.
+	std::string compiledResult = interpret(yulStack.parserResult(), /*_compiled=*/ true);
+	if (compiledResult != m_obtainedResult)
+	{
+		AnsiColorized(_stream, _formatted, {formatting::BOLD, formatting::RED}) <<
+			_linePrefix << "Compiled interpreter produced a different result:" << std::endl;
+		printPrefixed(_stream, compiledResult, _linePrefix + "  ");
+		return TestResult::FatalError;
+	}
 
 	return checkResult(_stream, _linePrefix, _formatted);
 }
 
-std::string YulInterpreterTest::interpret(std::shared_ptr<Object const> const& _object)
+std::string YulInterpreterTest::interpret(std::shared_ptr<Object const> const& _object, bool _compiled)
 {
 	solAssert(_object && _object->hasCode());
 
@@ -78,12 +92,20 @@ std::string YulInterpreterTest::interpret(std::shared_ptr<Object const> const& _
 	state.maxExprNesting = 64;
 	try
 	{
-		Interpreter::run(
-			state,
-			*_object->code(),
-			/*disableExternalCalls=*/ !m_simulateExternalCallsToSelf,
-			/*disableMemoryTracing=*/ false
-		);
+		if (_compiled)
+			CompiledInterpreter::run(
+				state,
+				*_object->code(),
+				/*disableExternalCalls=*/ !m_simulateExternalCallsToSelf,
+				/*disableMemoryTracing=*/ false
+			);
+		else
+			Interpreter::run(
+				state,
+				*_object->code(),
+				/*disableExternalCalls=*/ !m_simulateExternalCallsToSelf,
+				/*disableMemoryTracing=*/ false
+			);
 	}
 	catch (InterpreterTerminatedGeneric const&)
 	{
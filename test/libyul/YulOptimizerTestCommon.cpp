@@ -37,10 +37,12 @@
 #include <libyul/optimiser/FunctionHoister.h>
 #include <libyul/optimiser/FunctionSpecializer.h>
 #include <libyul/optimiser/ExpressionInliner.h>
+#include <libyul/optimiser/FreeMemoryPointerRewinder.h>
 #include <libyul/optimiser/FullInliner.h>
 #include <libyul/optimiser/ForLoopConditionIntoBody.h>
 #include <libyul/optimiser/ForLoopInitRewriter.h>
 #include <libyul/optimiser/LoadResolver.h>
+#include <libyul/optimiser/LoopIdiomRecogniser.h>
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/LoopUnrolling.h>
 #include <libyul/optimiser/StackLimitEvader.h>
@@ -56,6 +58,7 @@
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/UnusedAssignEliminator.h>
 #include <libyul/optimiser/UnusedStoreEliminator.h>
+#include <libyul/optimiser/StorageWriteCoalescer.h>
 #include <libyul/optimiser/StructuralSimplifier.h>
 #include <libyul/optimiser/StackCompressor.h>
 #include <libyul/optimiser/Suite.h>
@@ -200,6 +203,14 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(std::shared_ptr<Object const> _ob
 			ExpressionInliner::run(*m_context, block);
 			return block;
 		}},
+		{"freeMemoryPointerRewinder", [&]() {
+			auto block = disambiguate();
+			updateContext(block);
+			ForLoopInitRewriter::run(*m_context, block);
+			FunctionHoister::run(*m_context, block);
+			FreeMemoryPointerRewinder::run(*m_context, block);
+			return block;
+		}},
 		{"fullInliner", [&]() {
 			auto block = disambiguate();
 			updateContext(block);
@@ -320,6 +331,14 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(std::shared_ptr<Object const> _ob
 			EqualStoreEliminator::run(*m_context, block);
 			return block;
 		}},
+		{"storageWriteCoalescer", [&]() {
+			auto block = disambiguate();
+			updateContext(block);
+			FunctionHoister::run(*m_context, block);
+			ForLoopInitRewriter::run(*m_context, block);
+			StorageWriteCoalescer::run(*m_context, block);
+			return block;
+		}},
 		{"ssaPlusCleanup", [&]() {
 			auto block = disambiguate();
 			updateContext(block);
@@ -346,6 +365,14 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(std::shared_ptr<Object const> _ob
 			ExpressionJoiner::run(*m_context, block);
 			return block;
 		}},
+		{"loopIdiomRecogniser", [&]() {
+			auto block = disambiguate();
+			updateContext(block);
+			ForLoopInitRewriter::run(*m_context, block);
+			FunctionHoister::run(*m_context, block);
+			LoopIdiomRecogniser::run(*m_context, block);
+			return block;
+		}},
 		{"loopInvariantCodeMotion", [&]() {
 			auto block = disambiguate();
 			updateContext(block);
@@ -432,6 +459,7 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(std::shared_ptr<Object const> _ob
 				true,
 				frontend::OptimiserSettings::DefaultYulOptimiserSteps,
 				frontend::OptimiserSettings::DefaultYulOptimiserCleanupSteps,
+				frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment,
 				frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment
 			);
 			return std::get<Block>(ASTCopier{}(m_optimizedObject->code()->root()));
@@ -628,6 +628,33 @@ BOOST_AUTO_TEST_CASE(invalid_optimizer_sequence_without_optimize)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(dispatcher_selector_order)
+{
+	BOOST_TEST(parseCommandLine({"solc", "contract.sol"}).optimiserSettings().dispatcherSelectorOrder.empty());
+
+	CommandLineOptions const& commandLineOptions = parseCommandLine({
+		"solc",
+		"contract.sol",
+		"--via-ir",
+		"--dispatcher-selector-order=a9059cbb,70A08231,00000001",
+	});
+	std::vector<uint32_t> const expectedSelectors{0xa9059cbb, 0x70a08231, 0x00000001};
+	BOOST_TEST(commandLineOptions.optimizer.dispatcherSelectorOrder == expectedSelectors);
+	BOOST_TEST(commandLineOptions.optimiserSettings().dispatcherSelectorOrder == expectedSelectors);
+
+	for (std::string const invalidSelector: {"", "a9059cb", "a9059cbb0", "0xa9059c", "a9059cbg"})
+	{
+		std::string const expectedErrorMessage{
+			"Invalid function selector in --dispatcher-selector-order: \"" + invalidSelector + "\". "
+			"Expected 8 hexadecimal digits."
+		};
+		auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedErrorMessage; };
+
+		std::vector<std::string> commandLine{"solc", "contract.sol", "--dispatcher-selector-order=a9059cbb," + invalidSelector};
+		BOOST_CHECK_EXCEPTION(parseCommandLine(commandLine), CommandLineValidationError, hasCorrectMessage);
+	}
+}
+
 BOOST_AUTO_TEST_CASE(ethdebug)
 {
 	CommandLineOptions commandLineOptions = parseCommandLine({"solc", "contract.sol", "--debug-info", "ethdebug", "--ethdebug", "--via-ir"});
@@ -69,7 +69,10 @@ void IsolTestOptions::addOptions()
 		("help", po::bool_switch(&showHelp)->default_value(showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor)->default_value(noColor), "Don't use colors.")
 		("accept-updates", po::bool_switch(&acceptUpdates)->default_value(acceptUpdates), "Automatically accept expectation updates.")
-		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
+		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.")
+		("jobs,j", po::value<size_t>(&jobs)->default_value(jobs), "Number of worker processes running tests in parallel. More than one job disables the interactive prompts.")
+		("shard", po::value<std::string>(&shard), "Run only one shard of the tests, given as i/n with 1 <= i <= n. Same as --batches n --selected-batch i-1.")
+		("timing-report", po::value<std::string>(&timingReport), "Write the execution time of every test to the given JSON file.");
 }
 
 bool IsolTestOptions::parse(int _argc, char const* const* _argv)
@@ -84,6 +87,30 @@ bool IsolTestOptions::parse(int _argc, char const* const* _argv)
 
 	enforceGasTest = enforceGasTest || (evmVersion() == langutil::EVMVersion{} && !useABIEncoderV1);
 
+	if (!shard.empty())
+	{
+		static std::regex const shardExpression{"([0-9]{1,9})/([0-9]{1,9})"};
+		std::smatch match;
+		solRequire(
+			std::regex_match(shard, match, shardExpression),
+			ConfigException,
+			"Invalid shard, expected i/n: " + shard
+		);
+		solRequire(
+			batches == 1 && selectedBatch == 0,
+			ConfigException,
+			"--shard cannot be combined with --batches or --selected-batch."
+		);
+		size_t const index = std::stoul(match[1].str());
+		batches = std::stoul(match[2].str());
+		solRequire(
+			index >= 1 && index <= batches,
+			ConfigException,
+			"Shard index has to be between 1 and the number of shards: " + shard
+		);
+		selectedBatch = index - 1;
+	}
+
 	return shouldContinue;
 }
 
@@ -97,6 +124,10 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	solRequire(jobs > 0, ConfigException, "The number of jobs has to be at least 1.");
+#if defined(_WIN32)
+	solRequire(jobs == 1, ConfigException, "Running tests in parallel is not supported on Windows.");
+#endif
 }
 
 }
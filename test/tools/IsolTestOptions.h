@@ -34,6 +34,13 @@ struct IsolTestOptions: CommonOptions
 	bool acceptUpdates = false;
 	std::string testFilter = std::string{};
 	std::string editor = std::string{};
+	/// Number of worker processes running tests in parallel. Values above 1 disable the
+	/// interactive prompts.
+	size_t jobs = 1;
+	/// Shorthand for --batches and --selected-batch in the form "i/n", with 1 <= i <= n.
+	std::string shard = std::string{};
+	/// Path of the JSON file to write the execution time of every test to. Empty to disable.
+	std::string timingReport = std::string{};
 
 	explicit IsolTestOptions();
 	void addOptions() override;
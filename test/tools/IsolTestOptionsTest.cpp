@@ -0,0 +1,114 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the command-line options of isoltest.
+ */
+
+#include <test/tools/IsolTestOptions.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace solidity::test
+{
+
+namespace
+{
+
+void parse(IsolTestOptions& _options, std::vector<std::string> const& _arguments)
+{
+	std::vector<char const*> argv{"isoltest"};
+	for (std::string const& argument: _arguments)
+		argv.push_back(argument.c_str());
+
+	BOOST_REQUIRE(_options.parse(static_cast<int>(argv.size()), argv.data()));
+}
+
+void checkInvalid(std::vector<std::string> const& _arguments, std::string const& _expectedMessage)
+{
+	IsolTestOptions options;
+	BOOST_CHECK_EXCEPTION(
+		parse(options, _arguments),
+		ConfigException,
+		[&](ConfigException const& _exception) {
+			BOOST_TEST(_exception.what() == _expectedMessage);
+			return true;
+		}
+	);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(IsolTestOptionsTest)
+
+BOOST_AUTO_TEST_CASE(defaults)
+{
+	IsolTestOptions options;
+	parse(options, {});
+	BOOST_TEST(options.jobs == 1);
+	BOOST_TEST(options.shard.empty());
+	BOOST_TEST(options.timingReport.empty());
+	BOOST_TEST(options.batches == 1);
+	BOOST_TEST(options.selectedBatch == 0);
+}
+
+BOOST_AUTO_TEST_CASE(jobs_and_timing_report)
+{
+	IsolTestOptions options;
+	parse(options, {"--jobs", "4", "--timing-report", "/tmp/timing.json"});
+	BOOST_TEST(options.jobs == 4);
+	BOOST_TEST(options.timingReport == "/tmp/timing.json");
+
+	IsolTestOptions shortOptions;
+	parse(shortOptions, {"-j", "2"});
+	BOOST_TEST(shortOptions.jobs == 2);
+}
+
+BOOST_AUTO_TEST_CASE(shard)
+{
+	for (auto const& [shard, batches, selectedBatch]: std::vector<std::tuple<std::string, size_t, size_t>>{
+		{"2/4", 4, 1},
+		{"1/1", 1, 0},
+		{"3/3", 3, 2},
+		{"007/10", 10, 6},
+	})
+	{
+		IsolTestOptions options;
+		parse(options, {"--shard", shard});
+		BOOST_TEST(options.batches == batches);
+		BOOST_TEST(options.selectedBatch == selectedBatch);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(invalid_shard)
+{
+	for (std::string const shard: {"2", "2/", "/4", "a/4", "2/4/8", " 2/4", "1234567890/1"})
+		checkInvalid({"--shard", shard}, "Invalid shard, expected i/n: " + shard);
+	checkInvalid({"--shard", "0/4"}, "Shard index has to be between 1 and the number of shards: 0/4");
+	checkInvalid({"--shard", "5/4"}, "Shard index has to be between 1 and the number of shards: 5/4");
+	checkInvalid({"--shard", "1/0"}, "Shard index has to be between 1 and the number of shards: 1/0");
+	checkInvalid({"--shard", "1/2", "--batches", "2"}, "--shard cannot be combined with --batches or --selected-batch.");
+	checkInvalid({"--shard", "1/2", "--selected-batch", "1"}, "--shard cannot be combined with --batches or --selected-batch.");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -18,6 +18,7 @@
 
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/AnsiColorized.h>
+#include <libsolutil/JSON.h>
 
 #include <memory>
 #include <test/Common.h>
@@ -28,14 +29,23 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <optional>
 #include <queue>
 #include <regex>
 #include <utility>
 
 #if defined(_WIN32)
 #include <windows.h>
+#else
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 using namespace solidity;
@@ -65,6 +75,15 @@ struct TestStats
 	}
 };
 
+/// Execution time of a single test, collected for the timing report.
+struct TestTiming
+{
+	std::string suite;
+	std::string test;
+	std::string result;
+	double seconds = 0;
+};
+
 class TestFilter
 {
 public:
@@ -95,13 +114,15 @@ public:
 		TestCreator _testCaseCreator,
 		TestOptions const& _options,
 		fs::path _path,
-		std::string _name
+		std::string _name,
+		std::ostream& _output = std::cout
 	):
 		m_testCaseCreator(_testCaseCreator),
 		m_options(_options),
 		m_filter(TestFilter{_options.testFilter}),
 		m_path(std::move(_path)),
-		m_name(std::move(_name))
+		m_name(std::move(_name)),
+		m_output(_output)
 	{}
 
 	enum class Result
@@ -113,14 +134,35 @@ public:
 	};
 
 	Result process();
+	/// Runs the test without asking the user what to do on failure. Expectations are
+	/// updated only if updates are accepted automatically.
+	Result processNonInteractively();
+	/// @returns true if the test is selected by the test filter.
+	bool selected() const { return m_filter.matches(m_path, m_name); }
 
 	static TestStats processPath(
 		TestCreator _testCaseCreator,
 		TestOptions const& _options,
 		fs::path const& _basepath,
 		fs::path const& _path,
+		std::string const& _suiteName,
+		solidity::test::Batcher& _batcher
+	);
+#if !defined(_WIN32)
+	/// Same as @a processPath() but distributes the tests over @a TestOptions::jobs worker
+	/// processes. The output of each test is buffered and printed in the original order.
+	static TestStats processPathInParallel(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		fs::path const& _path,
+		std::string const& _suiteName,
 		solidity::test::Batcher& _batcher
 	);
+#endif
+
+	static std::vector<TestTiming> const& timings() { return m_timings; }
+
 private:
 	enum class Request
 	{
@@ -137,13 +179,38 @@ private:
 	TestFilter m_filter;
 	fs::path const m_path;
 	std::string const m_name;
+	std::ostream& m_output;
 
 	std::unique_ptr<TestCase> m_test;
 
 	static bool m_exitRequested;
+	static std::vector<TestTiming> m_timings;
 };
 
 bool TestTool::m_exitRequested = false;
+std::vector<TestTiming> TestTool::m_timings;
+
+namespace
+{
+
+std::string resultName(TestTool::Result _result)
+{
+	switch (_result)
+	{
+	case TestTool::Result::Success: return "success";
+	case TestTool::Result::Failure: return "failure";
+	case TestTool::Result::Exception: return "exception";
+	case TestTool::Result::Skipped: return "skipped";
+	}
+	util::unreachable();
+}
+
+double secondsSince(std::chrono::steady_clock::time_point _start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+}
+
+}
 
 TestTool::Result TestTool::process()
 {
@@ -153,7 +220,7 @@ TestTool::Result TestTool::process()
 	{
 		if (m_filter.matches(m_path, m_name))
 		{
-			(AnsiColorized(std::cout, formatted, {BOLD}) << m_name << ": ").flush();
+			(AnsiColorized(m_output, formatted, {BOLD}) << m_name << ": ").flush();
 
 			m_test = m_testCaseCreator(TestCase::Config{
 				m_path.string(),
@@ -169,22 +236,22 @@ TestTool::Result TestTool::process()
 				switch (TestCase::TestResult result = m_test->run(outputMessages, "  ", formatted))
 				{
 					case TestCase::TestResult::Success:
-						AnsiColorized(std::cout, formatted, {BOLD, GREEN}) << "OK" << std::endl;
+						AnsiColorized(m_output, formatted, {BOLD, GREEN}) << "OK" << std::endl;
 						return Result::Success;
 					default:
-						AnsiColorized(std::cout, formatted, {BOLD, RED}) << "FAIL" << std::endl;
+						AnsiColorized(m_output, formatted, {BOLD, RED}) << "FAIL" << std::endl;
 
-						AnsiColorized(std::cout, formatted, {BOLD, CYAN}) << "  Contract:" << std::endl;
-						m_test->printSource(std::cout, "    ", formatted);
-						m_test->printSettings(std::cout, "    ", formatted);
+						AnsiColorized(m_output, formatted, {BOLD, CYAN}) << "  Contract:" << std::endl;
+						m_test->printSource(m_output, "    ", formatted);
+						m_test->printSettings(m_output, "    ", formatted);
 
-						std::cout << std::endl << outputMessages.str() << std::endl;
+						m_output << std::endl << outputMessages.str() << std::endl;
 						return result == TestCase::TestResult::FatalError ? Result::Exception : Result::Failure;
 				}
 			}
 			else
 			{
-				AnsiColorized(std::cout, formatted, {BOLD, YELLOW}) << "NOT RUN" << std::endl;
+				AnsiColorized(m_output, formatted, {BOLD, YELLOW}) << "NOT RUN" << std::endl;
 				return Result::Skipped;
 			}
 		}
@@ -193,12 +260,24 @@ TestTool::Result TestTool::process()
 	}
 	catch (...)
 	{
-		AnsiColorized(std::cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(m_output, formatted, {BOLD, RED}) <<
 			"Unhandled exception during test: " << boost::current_exception_diagnostic_information() << std::endl;
 		return Result::Exception;
 	}
 }
 
+TestTool::Result TestTool::processNonInteractively()
+{
+	while (true)
+	{
+		Result result = process();
+		if (result != Result::Failure || !m_options.acceptUpdates)
+			return result;
+		updateTestCase();
+		m_output << "Re-running test case..." << std::endl;
+	}
+}
+
 void TestTool::updateTestCase()
 {
 	std::ofstream file(m_path.string(), std::ios::trunc);
@@ -257,6 +336,7 @@ TestStats TestTool::processPath(
 	TestOptions const& _options,
 	fs::path const& _basepath,
 	fs::path const& _path,
+	std::string const& _suiteName,
 	solidity::test::Batcher& _batcher
 )
 {
@@ -300,7 +380,15 @@ TestStats TestTool::processPath(
 				fullpath,
 				currentPath.generic_path().string()
 			);
+			auto start = std::chrono::steady_clock::now();
 			auto result = testTool.process();
+			if (testTool.selected())
+				m_timings.push_back({
+					_suiteName,
+					currentPath.generic_path().string(),
+					resultName(result),
+					secondsSince(start)
+				});
 
 			switch(result)
 			{
@@ -315,6 +403,8 @@ TestStats TestTool::processPath(
 				case Request::Rerun:
 					std::cout << "Re-running test case..." << std::endl;
 					--testCount;
+					// Only the final run of the test is reported.
+					m_timings.pop_back();
 					break;
 				case Request::Skip:
 					paths.pop();
@@ -338,6 +428,289 @@ TestStats TestTool::processPath(
 
 }
 
+#if !defined(_WIN32)
+
+namespace
+{
+
+/// Header of the message a worker process sends after finishing a test.
+/// It is followed by @a outputSize bytes of test output.
+struct WorkerMessage
+{
+	size_t index;
+	TestTool::Result result;
+	double seconds;
+	size_t outputSize;
+};
+
+bool readAll(int _fd, void* _data, size_t _size)
+{
+	auto* data = static_cast<char*>(_data);
+	while (_size > 0)
+	{
+		ssize_t count = read(_fd, data, _size);
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			return false;
+		data += count;
+		_size -= static_cast<size_t>(count);
+	}
+	return true;
+}
+
+bool writeAll(int _fd, void const* _data, size_t _size)
+{
+	auto const* data = static_cast<char const*>(_data);
+	while (_size > 0)
+	{
+		ssize_t count = write(_fd, data, _size);
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			return false;
+		data += count;
+		_size -= static_cast<size_t>(count);
+	}
+	return true;
+}
+
+/// Test process that receives indices of tests to run from the parent and reports back
+/// the result and the output of each test.
+struct Worker
+{
+	pid_t pid = -1;
+	/// Write end of the pipe the parent sends test indices through.
+	int taskFd = -1;
+	/// Read end of the pipe the worker reports results through.
+	int resultFd = -1;
+	/// Index of the test the worker is currently running.
+	std::optional<size_t> currentTest;
+};
+
+}
+
+TestStats TestTool::processPathInParallel(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	fs::path const& _path,
+	std::string const& _suiteName,
+	solidity::test::Batcher& _batcher
+)
+{
+	// Collect the tests in the same order in which processPath() would run them.
+	std::vector<fs::path> tests;
+	int skippedCount = 0;
+	std::queue<fs::path> paths;
+	paths.push(_path);
+	while (!paths.empty())
+	{
+		fs::path currentPath = paths.front();
+		paths.pop();
+		fs::path fullpath = _basepath / currentPath;
+		if (fs::is_directory(fullpath))
+		{
+			for (auto const& entry: boost::iterator_range<fs::directory_iterator>(
+				fs::directory_iterator(fullpath),
+				fs::directory_iterator()
+			))
+				if (fs::is_directory(entry.path()) || TestCase::isTestFilename(entry.path().filename()))
+					paths.push(currentPath / entry.path().filename());
+		}
+		else if (!_batcher.checkAndAdvance())
+			++skippedCount;
+		else
+			tests.push_back(currentPath);
+	}
+
+	struct Outcome
+	{
+		Result result;
+		double seconds;
+		std::string output;
+	};
+	std::vector<std::optional<Outcome>> outcomes(tests.size());
+	std::vector<Worker> workers;
+	size_t nextToAssign = 0;
+
+	// A worker that dies must not take the parent down when it sends the next task.
+	signal(SIGPIPE, SIG_IGN);
+
+	auto assignNextTest = [&](Worker& _worker)
+	{
+		if (nextToAssign < tests.size())
+		{
+			_worker.currentTest = nextToAssign++;
+			if (writeAll(_worker.taskFd, &*_worker.currentTest, sizeof(size_t)))
+				return;
+		}
+		else
+			_worker.currentTest.reset();
+		// No more work for this worker. Closing the pipe makes it exit.
+		close(_worker.taskFd);
+		_worker.taskFd = -1;
+	};
+
+	auto spawnWorker = [&]() -> Worker&
+	{
+		int taskPipe[2];
+		int resultPipe[2];
+		if (pipe(taskPipe) != 0 || pipe(resultPipe) != 0)
+			throw std::runtime_error("Failed to create a pipe for a worker process.");
+		std::cout.flush();
+		std::cerr.flush();
+		pid_t pid = fork();
+		if (pid < 0)
+			throw std::runtime_error("Failed to start a worker process.");
+		if (pid == 0)
+		{
+			// Keeping the pipes of other workers open would prevent them from ever seeing EOF.
+			for (Worker const& worker: workers)
+			{
+				if (worker.taskFd >= 0)
+					close(worker.taskFd);
+				if (worker.resultFd >= 0)
+					close(worker.resultFd);
+			}
+			close(taskPipe[1]);
+			close(resultPipe[0]);
+
+			size_t index = 0;
+			while (readAll(taskPipe[0], &index, sizeof(index)))
+			{
+				std::stringstream output;
+				TestTool testTool(
+					_testCaseCreator,
+					_options,
+					_basepath / tests[index],
+					tests[index].generic_path().string(),
+					output
+				);
+				auto start = std::chrono::steady_clock::now();
+				Result result = testTool.processNonInteractively();
+				std::string text = output.str();
+				WorkerMessage message{index, result, secondsSince(start), text.size()};
+				if (
+					!writeAll(resultPipe[1], &message, sizeof(message)) ||
+					!writeAll(resultPipe[1], text.data(), text.size())
+				)
+					break;
+			}
+			// Skip destructors and exit handlers, they belong to the parent process.
+			_exit(EXIT_SUCCESS);
+		}
+		close(taskPipe[0]);
+		close(resultPipe[1]);
+		Worker& worker = workers.emplace_back(Worker{pid, taskPipe[1], resultPipe[0], std::nullopt});
+		assignNextTest(worker);
+		return worker;
+	};
+
+	for (size_t i = 0; i < std::min(_options.jobs, tests.size()); ++i)
+		spawnWorker();
+
+	int successCount = 0;
+	size_t nextToPrint = 0;
+	bool formatted{!_options.noColor};
+	TestFilter filter{_options.testFilter};
+	while (nextToPrint < tests.size())
+	{
+		std::vector<pollfd> pollFds;
+		std::vector<size_t> pollWorkers;
+		for (size_t i = 0; i < workers.size(); ++i)
+			if (workers[i].resultFd >= 0)
+			{
+				pollFds.push_back({workers[i].resultFd, POLLIN, 0});
+				pollWorkers.push_back(i);
+			}
+		solAssert(!pollFds.empty());
+		if (poll(pollFds.data(), pollFds.size(), -1) < 0)
+		{
+			if (errno != EINTR)
+				throw std::runtime_error("Failed to wait for worker processes.");
+			continue;
+		}
+
+		for (size_t i = 0; i < pollFds.size(); ++i)
+		{
+			if (pollFds[i].revents == 0)
+				continue;
+			// Worker references are invalidated when a replacement worker is spawned.
+			size_t workerIndex = pollWorkers[i];
+			WorkerMessage message;
+			std::string output;
+			bool received = readAll(workers[workerIndex].resultFd, &message, sizeof(message));
+			if (received)
+			{
+				output.resize(message.outputSize);
+				received = readAll(workers[workerIndex].resultFd, output.data(), output.size());
+			}
+			if (received)
+			{
+				outcomes[message.index] = Outcome{message.result, message.seconds, std::move(output)};
+				assignNextTest(workers[workerIndex]);
+				continue;
+			}
+
+			// The worker terminated, either because it ran out of tests or because it crashed.
+			close(workers[workerIndex].resultFd);
+			workers[workerIndex].resultFd = -1;
+			if (workers[workerIndex].taskFd >= 0)
+				close(workers[workerIndex].taskFd);
+			workers[workerIndex].taskFd = -1;
+			waitpid(workers[workerIndex].pid, nullptr, 0);
+			if (std::optional<size_t> crashedTest = workers[workerIndex].currentTest)
+			{
+				std::stringstream crashOutput;
+				AnsiColorized(crashOutput, formatted, {BOLD}) << tests[*crashedTest].generic_path().string() << ": ";
+				AnsiColorized(crashOutput, formatted, {BOLD, RED}) << "FAIL" << std::endl;
+				crashOutput << "  Worker process terminated unexpectedly." << std::endl;
+				outcomes[*crashedTest] = Outcome{Result::Exception, 0, crashOutput.str()};
+				workers[workerIndex].currentTest.reset();
+				if (nextToAssign < tests.size())
+					spawnWorker();
+			}
+		}
+
+		for (; nextToPrint < tests.size() && outcomes[nextToPrint]; ++nextToPrint)
+		{
+			Outcome const& outcome = *outcomes[nextToPrint];
+			std::cout << outcome.output;
+			std::cout.flush();
+
+			if (outcome.result == Result::Success)
+				++successCount;
+			else if (outcome.result == Result::Skipped)
+				++skippedCount;
+
+			std::string name = tests[nextToPrint].generic_path().string();
+			if (filter.matches(_basepath / tests[nextToPrint], name))
+				m_timings.push_back({
+					_suiteName,
+					name,
+					resultName(outcome.result),
+					outcome.seconds
+				});
+		}
+	}
+
+	for (Worker& worker: workers)
+	{
+		if (worker.taskFd >= 0)
+			close(worker.taskFd);
+		if (worker.resultFd >= 0)
+		{
+			close(worker.resultFd);
+			waitpid(worker.pid, nullptr, 0);
+		}
+	}
+
+	return {successCount, static_cast<int>(tests.size()), skippedCount};
+}
+
+#endif
+
 namespace
 {
 
@@ -361,6 +734,32 @@ void setupTerminal()
 #endif
 }
 
+void writeTimingReport(std::string const& _path, std::vector<TestTiming> _timings)
+{
+	// Slowest tests first.
+	std::stable_sort(_timings.begin(), _timings.end(), [](TestTiming const& _a, TestTiming const& _b) {
+		return _a.seconds > _b.seconds;
+	});
+
+	double totalSeconds = 0;
+	Json tests = Json::array();
+	for (TestTiming const& timing: _timings)
+	{
+		totalSeconds += timing.seconds;
+		tests.push_back({
+			{"suite", timing.suite},
+			{"test", timing.test},
+			{"result", timing.result},
+			{"seconds", timing.seconds}
+		});
+	}
+
+	std::ofstream file(_path, std::ios::trunc);
+	file << jsonPrettyPrint(Json{{"totalSeconds", totalSeconds}, {"tests", std::move(tests)}}) << std::endl;
+	if (!file)
+		std::cerr << "Failed to write the timing report to " << _path << "." << std::endl;
+}
+
 std::optional<TestStats> runTestSuite(
 	TestCreator _testCaseCreator,
 	TestOptions const& _options,
@@ -379,11 +778,17 @@ std::optional<TestStats> runTestSuite(
 		return std::nullopt;
 	}
 
-	TestStats stats = TestTool::processPath(
+#if !defined(_WIN32)
+	auto processPath = _options.jobs > 1 ? &TestTool::processPathInParallel : &TestTool::processPath;
+#else
+	auto processPath = &TestTool::processPath;
+#endif
+	TestStats stats = processPath(
 		_testCaseCreator,
 		_options,
 		_basePath,
 		_subdirectory,
+		_name,
 		_batcher
 	);
 
@@ -481,6 +886,9 @@ int main(int argc, char const *argv[])
 		if (options.disableSemanticTests)
 			std::cout << "\nNOTE: Skipped semantics tests.\n" << std::endl;
 
+		if (!options.timingReport.empty())
+			writeTimingReport(options.timingReport, TestTool::timings());
+
 		return global_stats ? EXIT_SUCCESS : EXIT_FAILURE;
 	}
 	catch (boost::program_options::error const& exception)
@@ -51,7 +51,7 @@ yulFuzzerUtil::TerminationReason yulFuzzerUtil::interpret(
 	TerminationReason reason = TerminationReason::None;
 	try
 	{
-		Interpreter::run(state, _ast, true, _disableMemoryTracing);
+		CompiledInterpreter::run(state, _ast, true, _disableMemoryTracing);
 	}
 	catch (StepLimitReached const&)
 	{
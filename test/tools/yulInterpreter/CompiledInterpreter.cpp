@@ -0,0 +1,731 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter that lowers the code to closures before executing it.
+ */
+
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
+
+#include <test/tools/yulInterpreter/EVMInstructionInterpreter.h>
+
+#include <libyul/AST.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Utilities.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <libevmasm/Instruction.h>
+
+#include <libsolutil/Visitor.h>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::yul::test;
+
+using solidity::evmasm::Instruction;
+
+namespace
+{
+
+EVMDialect const& requireEVMDialect(Dialect const& _dialect)
+{
+	auto const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect);
+	yulAssert(evmDialect, "The compiled interpreter only supports EVM dialects.");
+	return *evmDialect;
+}
+
+}
+
+/**
+ * State of a single execution of the lowered code.
+ */
+struct CompiledInterpreter::Execution
+{
+	CompiledInterpreter const& interpreter;
+	InterpreterState& state;
+	bool disableExternalCalls;
+	bool disableMemoryTrace;
+	/// Slots of all active call frames, the innermost frame last.
+	std::vector<u256> slots;
+	/// Index of the first slot of the innermost call frame.
+	size_t frameBase = 0;
+
+	u256& slot(size_t _index) { return slots[frameBase + _index]; }
+
+	/// Counts one interpreter step, throwing if the step limit is reached.
+	void incrementStep();
+	/// Counts one expression evaluation, throwing if the nesting limit is exceeded.
+	void incrementNestingLevel(unsigned& _nestingLevel);
+
+	std::vector<u256> call(size_t _function, std::vector<u256> const& _arguments);
+	void runExternalCall(Instruction _instruction, std::vector<u256> const& _arguments);
+};
+
+void CompiledInterpreter::Execution::incrementStep()
+{
+	state.numSteps++;
+	if (state.maxSteps > 0 && state.numSteps >= state.maxSteps)
+	{
+		state.trace.emplace_back("Interpreter execution step limit reached.");
+		BOOST_THROW_EXCEPTION(StepLimitReached());
+	}
+}
+
+void CompiledInterpreter::Execution::incrementNestingLevel(unsigned& _nestingLevel)
+{
+	_nestingLevel++;
+	if (state.maxExprNesting > 0 && _nestingLevel > state.maxExprNesting)
+	{
+		state.trace.emplace_back("Maximum expression nesting level reached.");
+		BOOST_THROW_EXCEPTION(ExpressionNestingLimitReached());
+	}
+}
+
+std::vector<u256> CompiledInterpreter::Execution::call(
+	size_t _function,
+	std::vector<u256> const& _arguments
+)
+{
+	Function const& function = interpreter.m_functions[_function];
+	yulAssert(_arguments.size() == function.numParameters);
+
+	state.controlFlowState = ControlFlowState::Default;
+	size_t callerFrameBase = frameBase;
+	frameBase = slots.size();
+	// Newly added slots are zero, which initialises the return variables.
+	slots.resize(frameBase + function.numSlots);
+	for (size_t i = 0; i < _arguments.size(); ++i)
+		slots[frameBase + i] = _arguments[i];
+
+	function.body(*this);
+	state.controlFlowState = ControlFlowState::Default;
+
+	std::vector<u256> returnValues(function.numReturnVariables);
+	for (size_t i = 0; i < returnValues.size(); ++i)
+		returnValues[i] = slots[frameBase + function.numParameters + i];
+	slots.resize(frameBase);
+	frameBase = callerFrameBase;
+	return returnValues;
+}
+
+void CompiledInterpreter::Execution::runExternalCall(
+	Instruction _instruction,
+	std::vector<u256> const& _arguments
+)
+{
+	u256 memOutOffset = 0;
+	u256 memOutSize = 0;
+	u256 callvalue = 0;
+	u256 memInOffset = 0;
+	u256 memInSize = 0;
+
+	if (_instruction == Instruction::CALL || _instruction == Instruction::CALLCODE)
+	{
+		memOutOffset = _arguments[5];
+		memOutSize = _arguments[6];
+		callvalue = _arguments[2];
+		memInOffset = _arguments[3];
+		memInSize = _arguments[4];
+	}
+	else if (_instruction == Instruction::DELEGATECALL || _instruction == Instruction::STATICCALL)
+	{
+		memOutOffset = _arguments[4];
+		memOutSize = _arguments[5];
+		memInOffset = _arguments[2];
+		memInSize = _arguments[3];
+	}
+	else
+		yulAssert(false);
+
+	// Don't execute external call if it isn't our own address
+	if (_arguments[1] != util::h160::Arith(state.address))
+		return;
+
+	InterpreterState calleeState;
+	calleeState.calldata = state.readMemory(memInOffset, memInSize);
+	calleeState.callvalue = callvalue;
+	calleeState.numInstance = state.numInstance + 1;
+
+	yulAssert(calleeState.numInstance < 1024, "Detected more than 1024 recursive calls, aborting...");
+
+	try
+	{
+		interpreter(calleeState, disableExternalCalls, disableMemoryTrace);
+	}
+	catch (ExplicitlyTerminatedWithReturn const&)
+	{
+		// Copy return data to our memory
+		copyZeroExtended(
+			state.memory,
+			calleeState.returndata,
+			memOutOffset.convert_to<size_t>(),
+			0,
+			memOutSize.convert_to<size_t>()
+		);
+		state.returndata = calleeState.returndata;
+	}
+}
+
+/**
+ * Lowers the AST to closures. Resolves variables to frame slots and function names to
+ * indices into the function table of the interpreter.
+ */
+class CompiledInterpreter::Lowering
+{
+public:
+	explicit Lowering(CompiledInterpreter& _interpreter): m_interpreter(_interpreter) {}
+
+	/// Lowers a block. The resulting code counts one step per statement, like
+	/// @a Interpreter::operator()(Block const&).
+	StatementCode block(Block const& _block);
+
+	size_t numSlots() const { return m_numSlots; }
+
+private:
+	/// Lowers a single statement. Returns empty code for function definitions.
+	StatementCode statement(Statement const& _statement);
+	StatementCode forLoop(ForLoop const& _forLoop);
+	StatementCode switchStatement(Switch const& _switch);
+	void functionDefinition(FunctionDefinition const& _function);
+
+	ExpressionCode expression(Expression const& _expression);
+	ExpressionCode builtinCall(FunctionCall const& _call, BuiltinFunctionForEVM const& _builtin);
+	FunctionCallCode functionCall(FunctionCall const& _call);
+
+	void enterScope(std::vector<Statement> const& _statements);
+	void leaveScope();
+	size_t declareVariable(YulName _name);
+	size_t variableSlot(YulName _name) const;
+	size_t functionIndex(YulName _name) const;
+
+	/// @returns the gas charged by the interpreter for the given control flow instructions.
+	u256 gasCost(std::initializer_list<Instruction> _instructions) const;
+
+	CompiledInterpreter& m_interpreter;
+	/// Slots of the variables visible in the current function, innermost scope last.
+	std::vector<std::map<YulName, size_t>> m_variableScopes;
+	/// Indices of the visible functions, innermost scope last.
+	std::vector<std::map<YulName, size_t>> m_functionScopes;
+	/// Number of slots used by the function currently being lowered.
+	size_t m_numSlots = 0;
+};
+
+CompiledInterpreter::StatementCode CompiledInterpreter::Lowering::block(Block const& _block)
+{
+	enterScope(_block.statements);
+	std::vector<StatementCode> statements;
+	for (auto const& s: _block.statements)
+		statements.emplace_back(statement(s));
+	leaveScope();
+
+	return [statements = std::move(statements)](Execution& _execution)
+	{
+		for (auto const& code: statements)
+		{
+			_execution.incrementStep();
+			if (code)
+				code(_execution);
+			if (_execution.state.controlFlowState != ControlFlowState::Default)
+				break;
+		}
+	};
+}
+
+CompiledInterpreter::StatementCode CompiledInterpreter::Lowering::statement(Statement const& _statement)
+{
+	return std::visit(util::GenericVisitor{
+		[&](ExpressionStatement const& _expressionStatement) -> StatementCode
+		{
+			if (
+				auto const* call = std::get_if<FunctionCall>(&_expressionStatement.expression);
+				call && !resolveBuiltinFunctionForEVM(call->functionName, m_interpreter.m_dialect)
+			)
+				return [code = functionCall(*call)](Execution& _execution)
+				{
+					unsigned nestingLevel = 0;
+					code(_execution, nestingLevel);
+				};
+			return [code = expression(_expressionStatement.expression)](Execution& _execution)
+			{
+				unsigned nestingLevel = 0;
+				code(_execution, nestingLevel);
+			};
+		},
+		[&](Assignment const& _assignment) -> StatementCode
+		{
+			yulAssert(_assignment.value);
+			std::vector<size_t> slots;
+			for (auto const& variable: _assignment.variableNames)
+				slots.emplace_back(variableSlot(variable.name));
+			if (slots.size() == 1)
+				return [
+					code = expression(*_assignment.value),
+					slot = slots.front()
+				](Execution& _execution)
+				{
+					unsigned nestingLevel = 0;
+					u256 value = code(_execution, nestingLevel);
+					_execution.slot(slot) = value;
+				};
+			return [
+				code = functionCall(std::get<FunctionCall>(*_assignment.value)),
+				slots = std::move(slots)
+			](Execution& _execution)
+			{
+				unsigned nestingLevel = 0;
+				std::vector<u256> values = code(_execution, nestingLevel);
+				yulAssert(values.size() == slots.size());
+				for (size_t i = 0; i < slots.size(); ++i)
+					_execution.slot(slots[i]) = values[i];
+			};
+		},
+		[&](VariableDeclaration const& _declaration) -> StatementCode
+		{
+			// The value cannot refer to the declared variables, so lower it first.
+			ExpressionCode value;
+			FunctionCallCode values;
+			if (_declaration.value && _declaration.variables.size() == 1)
+				value = expression(*_declaration.value);
+			else if (_declaration.value)
+				values = functionCall(std::get<FunctionCall>(*_declaration.value));
+
+			std::vector<size_t> slots;
+			for (auto const& variable: _declaration.variables)
+				slots.emplace_back(declareVariable(variable.name));
+
+			if (value)
+				return [value = std::move(value), slot = slots.front()](Execution& _execution)
+				{
+					unsigned nestingLevel = 0;
+					u256 result = value(_execution, nestingLevel);
+					_execution.slot(slot) = result;
+				};
+			if (values)
+				return [values = std::move(values), slots = std::move(slots)](Execution& _execution)
+				{
+					unsigned nestingLevel = 0;
+					std::vector<u256> results = values(_execution, nestingLevel);
+					yulAssert(results.size() == slots.size());
+					for (size_t i = 0; i < slots.size(); ++i)
+						_execution.slot(slots[i]) = results[i];
+				};
+			return [slots = std::move(slots)](Execution& _execution)
+			{
+				for (size_t slot: slots)
+					_execution.slot(slot) = 0;
+			};
+		},
+		[&](FunctionDefinition const& _function) -> StatementCode
+		{
+			functionDefinition(_function);
+			return {};
+		},
+		[&](If const& _if) -> StatementCode
+		{
+			yulAssert(_if.condition);
+			return [
+				condition = expression(*_if.condition),
+				body = block(_if.body),
+				gas = gasCost({Instruction::ISZERO, Instruction::JUMPI, Instruction::JUMPDEST})
+			](Execution& _execution)
+			{
+				_execution.state.gasUsed += gas;
+				unsigned nestingLevel = 0;
+				if (condition(_execution, nestingLevel) != 0)
+					body(_execution);
+			};
+		},
+		[&](Switch const& _switch) -> StatementCode
+		{
+			return switchStatement(_switch);
+		},
+		[&](ForLoop const& _forLoop) -> StatementCode
+		{
+			return forLoop(_forLoop);
+		},
+		[&](Break const&) -> StatementCode
+		{
+			return [](Execution& _execution)
+			{
+				_execution.state.controlFlowState = ControlFlowState::Break;
+			};
+		},
+		[&](Continue const&) -> StatementCode
+		{
+			return [](Execution& _execution)
+			{
+				_execution.state.controlFlowState = ControlFlowState::Continue;
+			};
+		},
+		[&](Leave const&) -> StatementCode
+		{
+			return [](Execution& _execution)
+			{
+				_execution.state.controlFlowState = ControlFlowState::Leave;
+			};
+		},
+		[&](Block const& _block) -> StatementCode
+		{
+			return block(_block);
+		}
+	}, _statement);
+}
+
+CompiledInterpreter::StatementCode CompiledInterpreter::Lowering::forLoop(ForLoop const& _forLoop)
+{
+	yulAssert(_forLoop.condition);
+
+	// Variables declared in the init block are visible in the whole loop.
+	enterScope(_forLoop.pre.statements);
+	// Like in the AST-based interpreter, statements of the init block do not count as steps.
+	std::vector<StatementCode> pre;
+	for (auto const& s: _forLoop.pre.statements)
+		pre.emplace_back(statement(s));
+	ExpressionCode condition = expression(*_forLoop.condition);
+	StatementCode body = block(_forLoop.body);
+	StatementCode post = block(_forLoop.post);
+	leaveScope();
+
+	return [
+		pre = std::move(pre),
+		condition = std::move(condition),
+		body = std::move(body),
+		post = std::move(post),
+		emptyBodyAndPost = _forLoop.body.statements.empty() && _forLoop.post.statements.empty(),
+		conditionGas = gasCost({Instruction::ISZERO, Instruction::JUMPI}),
+		backEdgeGas = gasCost({Instruction::JUMP, Instruction::JUMPDEST})
+	](Execution& _execution)
+	{
+		InterpreterState& state = _execution.state;
+		for (auto const& code: pre)
+		{
+			if (code)
+				code(_execution);
+			if (state.controlFlowState == ControlFlowState::Leave)
+				return;
+		}
+		while (true)
+		{
+			state.gasUsed += conditionGas;
+			unsigned nestingLevel = 0;
+			if (condition(_execution, nestingLevel) == 0)
+				break;
+
+			// Increment step for each loop iteration for loops with
+			// an empty body and post blocks to prevent a deadlock.
+			if (emptyBodyAndPost)
+				_execution.incrementStep();
+
+			state.controlFlowState = ControlFlowState::Default;
+			body(_execution);
+			if (
+				state.controlFlowState == ControlFlowState::Break ||
+				state.controlFlowState == ControlFlowState::Leave
+			)
+				break;
+
+			state.controlFlowState = ControlFlowState::Default;
+			post(_execution);
+			if (state.controlFlowState == ControlFlowState::Leave)
+				break;
+			state.gasUsed += backEdgeGas;
+		}
+		if (state.controlFlowState != ControlFlowState::Leave)
+			state.controlFlowState = ControlFlowState::Default;
+	};
+}
+
+CompiledInterpreter::StatementCode CompiledInterpreter::Lowering::switchStatement(Switch const& _switch)
+{
+	yulAssert(_switch.expression);
+	yulAssert(!_switch.cases.empty());
+
+	struct Case
+	{
+		/// Not set for the default case.
+		std::optional<u256> value;
+		StatementCode body;
+	};
+	std::vector<Case> cases;
+	for (auto const& c: _switch.cases)
+		cases.emplace_back(Case{
+			c.value ? std::make_optional(c.value->value.value()) : std::nullopt,
+			block(c.body)
+		});
+
+	return [
+		selector = expression(*_switch.expression),
+		cases = std::move(cases),
+		caseGas = gasCost({Instruction::DUP1, Instruction::EQ, Instruction::JUMPI}),
+		jumpdestGas = gasCost({Instruction::JUMPDEST})
+	](Execution& _execution)
+	{
+		unsigned nestingLevel = 0;
+		u256 value = selector(_execution, nestingLevel);
+		for (auto const& c: cases)
+		{
+			if (c.value)
+				_execution.state.gasUsed += caseGas;
+			// Default case has to be last.
+			if (!c.value || *c.value == value)
+			{
+				_execution.state.gasUsed += jumpdestGas;
+				c.body(_execution);
+				break;
+			}
+		}
+	};
+}
+
+void CompiledInterpreter::Lowering::functionDefinition(FunctionDefinition const& _function)
+{
+	size_t index = m_functionScopes.back().at(_function.name);
+
+	// Functions cannot access variables of the enclosing scopes.
+	auto outerVariableScopes = std::exchange(m_variableScopes, {{}});
+	size_t outerNumSlots = std::exchange(m_numSlots, 0);
+
+	for (auto const& parameter: _function.parameters)
+		declareVariable(parameter.name);
+	for (auto const& returnVariable: _function.returnVariables)
+		declareVariable(returnVariable.name);
+	StatementCode body = block(_function.body);
+
+	m_interpreter.m_functions[index] = Function{
+		std::move(body),
+		_function.parameters.size(),
+		_function.returnVariables.size(),
+		m_numSlots
+	};
+
+	m_variableScopes = std::move(outerVariableScopes);
+	m_numSlots = outerNumSlots;
+}
+
+CompiledInterpreter::ExpressionCode CompiledInterpreter::Lowering::expression(
+	Expression const& _expression
+)
+{
+	return std::visit(util::GenericVisitor{
+		[&](Literal const& _literal) -> ExpressionCode
+		{
+			return [value = _literal.value.value()](Execution& _execution, unsigned& _nestingLevel)
+			{
+				_execution.incrementNestingLevel(_nestingLevel);
+				return value;
+			};
+		},
+		[&](Identifier const& _identifier) -> ExpressionCode
+		{
+			size_t slot = variableSlot(_identifier.name);
+			return [slot](Execution& _execution, unsigned& _nestingLevel)
+			{
+				_execution.incrementNestingLevel(_nestingLevel);
+				return _execution.slot(slot);
+			};
+		},
+		[&](FunctionCall const& _call) -> ExpressionCode
+		{
+			if (auto const* builtin = resolveBuiltinFunctionForEVM(_call.functionName, m_interpreter.m_dialect))
+				return builtinCall(_call, *builtin);
+			return [call = functionCall(_call)](Execution& _execution, unsigned& _nestingLevel)
+			{
+				std::vector<u256> values = call(_execution, _nestingLevel);
+				yulAssert(values.size() == 1);
+				return values.front();
+			};
+		}
+	}, _expression);
+}
+
+CompiledInterpreter::ExpressionCode CompiledInterpreter::Lowering::builtinCall(
+	FunctionCall const& _call,
+	BuiltinFunctionForEVM const& _builtin
+)
+{
+	std::vector<ExpressionCode> arguments;
+	// Values of the arguments that have to be literals, these are not evaluated.
+	std::vector<u256> literalArguments(_call.arguments.size(), 0);
+	for (size_t i = 0; i < _call.arguments.size(); ++i)
+		if (_builtin.literalArgument(i))
+		{
+			Literal const& literal = std::get<Literal>(_call.arguments[i]);
+			if (literal.value.unlimited())
+			{
+				yulAssert(literal.kind == LiteralKind::String);
+				literalArguments[i] = 0xdeadbeef;
+			}
+			else
+				literalArguments[i] = literal.value.value();
+			arguments.emplace_back();
+		}
+		else
+			arguments.emplace_back(expression(_call.arguments[i]));
+
+	return [
+		&builtin = _builtin,
+		&callArguments = _call.arguments,
+		arguments = std::move(arguments),
+		literalArguments = std::move(literalArguments),
+		externalCall = _builtin.instruction && evmasm::isCallInstruction(*_builtin.instruction)
+	](Execution& _execution, unsigned& _nestingLevel)
+	{
+		_execution.incrementNestingLevel(_nestingLevel);
+		// Function arguments are evaluated in reverse.
+		std::vector<u256> values(arguments.size());
+		for (size_t i = arguments.size(); i > 0; --i)
+			values[i - 1] =
+				arguments[i - 1] ?
+				arguments[i - 1](_execution, _nestingLevel) :
+				literalArguments[i - 1];
+
+		EVMInstructionInterpreter instructionInterpreter(
+			_execution.interpreter.m_dialect.evmVersion(),
+			_execution.state,
+			_execution.disableMemoryTrace
+		);
+		u256 value = instructionInterpreter.evalBuiltin(builtin, callArguments, values);
+		if (externalCall && !_execution.disableExternalCalls)
+			_execution.runExternalCall(*builtin.instruction, values);
+		return value;
+	};
+}
+
+CompiledInterpreter::FunctionCallCode CompiledInterpreter::Lowering::functionCall(
+	FunctionCall const& _call
+)
+{
+	yulAssert(!isBuiltinFunctionCall(_call));
+	std::vector<ExpressionCode> arguments;
+	for (auto const& argument: _call.arguments)
+		arguments.emplace_back(expression(argument));
+
+	return [
+		function = functionIndex(std::get<Identifier>(_call.functionName).name),
+		arguments = std::move(arguments),
+		// Pushing the return label, jumping into the function and jumping back.
+		gas = gasCost({
+			Instruction::PUSH1,
+			Instruction::JUMP,
+			Instruction::JUMPDEST,
+			Instruction::JUMP,
+			Instruction::JUMPDEST
+		})
+	](Execution& _execution, unsigned& _nestingLevel)
+	{
+		_execution.incrementNestingLevel(_nestingLevel);
+		// Function arguments are evaluated in reverse.
+		std::vector<u256> values(arguments.size());
+		for (size_t i = arguments.size(); i > 0; --i)
+			values[i - 1] = arguments[i - 1](_execution, _nestingLevel);
+
+		_execution.state.gasUsed += gas;
+		return _execution.call(function, values);
+	};
+}
+
+void CompiledInterpreter::Lowering::enterScope(std::vector<Statement> const& _statements)
+{
+	m_variableScopes.emplace_back();
+	m_functionScopes.emplace_back();
+	// Functions are visible in the whole block, also before their definition.
+	for (auto const& statement: _statements)
+		if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+		{
+			m_functionScopes.back().emplace(function->name, m_interpreter.m_functions.size());
+			m_interpreter.m_functions.emplace_back();
+		}
+}
+
+void CompiledInterpreter::Lowering::leaveScope()
+{
+	m_variableScopes.pop_back();
+	m_functionScopes.pop_back();
+}
+
+size_t CompiledInterpreter::Lowering::declareVariable(YulName _name)
+{
+	yulAssert(!m_variableScopes.empty());
+	bool inserted = m_variableScopes.back().emplace(_name, m_numSlots).second;
+	yulAssert(inserted, "Variable declared twice.");
+	return m_numSlots++;
+}
+
+size_t CompiledInterpreter::Lowering::variableSlot(YulName _name) const
+{
+	for (auto scope = m_variableScopes.rbegin(); scope != m_variableScopes.rend(); ++scope)
+		if (auto it = scope->find(_name); it != scope->end())
+			return it->second;
+	yulAssert(false, "Variable not found.");
+}
+
+size_t CompiledInterpreter::Lowering::functionIndex(YulName _name) const
+{
+	for (auto scope = m_functionScopes.rbegin(); scope != m_functionScopes.rend(); ++scope)
+		if (auto it = scope->find(_name); it != scope->end())
+			return it->second;
+	yulAssert(false, "Function not found.");
+}
+
+u256 CompiledInterpreter::Lowering::gasCost(std::initializer_list<Instruction> _instructions) const
+{
+	langutil::EVMVersion evmVersion = m_interpreter.m_dialect.evmVersion();
+	u256 cost = 0;
+	for (Instruction instruction: _instructions)
+		cost += EVMInstructionInterpreter::staticGasCost(instruction, evmVersion);
+	return cost;
+}
+
+void CompiledInterpreter::run(
+	InterpreterState& _state,
+	AST const& _ast,
+	bool _disableExternalCalls,
+	bool _disableMemoryTracing
+)
+{
+	CompiledInterpreter interpreter{_ast.root(), _ast.dialect()};
+	interpreter(_state, _disableExternalCalls, _disableMemoryTracing);
+}
+
+CompiledInterpreter::CompiledInterpreter(Block const& _code, Dialect const& _dialect):
+	m_dialect(requireEVMDialect(_dialect))
+{
+	Lowering lowering(*this);
+	m_code = lowering.block(_code);
+	m_numSlots = lowering.numSlots();
+}
+
+void CompiledInterpreter::operator()(
+	InterpreterState& _state,
+	bool _disableExternalCalls,
+	bool _disableMemoryTracing
+) const
+{
+	Execution execution{
+		*this,
+		_state,
+		_disableExternalCalls,
+		_disableMemoryTracing,
+		std::vector<u256>(m_numSlots),
+		0
+	};
+	m_code(execution);
+}
@@ -0,0 +1,106 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter that lowers the code to closures before executing it.
+ */
+
+#pragma once
+
+#include <test/tools/yulInterpreter/Interpreter.h>
+
+#include <libyul/ASTForward.h>
+
+#include <libsolutil/Numeric.h>
+
+#include <functional>
+#include <vector>
+
+namespace solidity::yul
+{
+class Dialect;
+class EVMDialect;
+}
+
+namespace solidity::yul::test
+{
+
+/**
+ * Alternative execution engine for the Yul interpreter.
+ *
+ * The code is lowered once into a tree of closures. Variables are resolved to slots of
+ * a call frame and function calls are resolved to entries of a function table, so that
+ * executing the code does not perform any name lookups and does not create a new
+ * interpreter for each function call. Call frames live on a single stack that is reused
+ * by all calls.
+ *
+ * The observable behaviour (trace, memory, storage, gas, step and nesting limits) is
+ * identical to that of @a Interpreter. Use @a InspectedInterpreter for interactive
+ * debugging, this engine does not provide inspection hooks.
+ *
+ * Only EVM dialects are supported. The lowered code refers to the AST, which has to
+ * outlive this object.
+ */
+class CompiledInterpreter
+{
+public:
+	/// Lowers and executes the code. Drop-in replacement for @a Interpreter::run.
+	static void run(
+		InterpreterState& _state,
+		AST const& _ast,
+		bool _disableExternalCalls,
+		bool _disableMemoryTracing
+	);
+
+	CompiledInterpreter(Block const& _code, Dialect const& _dialect);
+
+	/// Executes the code on @a _state. Can be called any number of times, also with
+	/// different states.
+	void operator()(
+		InterpreterState& _state,
+		bool _disableExternalCalls,
+		bool _disableMemoryTracing
+	) const;
+
+private:
+	struct Execution;
+	class Lowering;
+
+	using StatementCode = std::function<void(Execution&)>;
+	/// Code of an expression that evaluates to exactly one value. The second argument is
+	/// the nesting level counter of the statement the expression belongs to.
+	using ExpressionCode = std::function<u256(Execution&, unsigned&)>;
+	/// Code of a call to a user-defined function, evaluating to all its return values.
+	using FunctionCallCode = std::function<std::vector<u256>(Execution&, unsigned&)>;
+
+	struct Function
+	{
+		StatementCode body;
+		size_t numParameters = 0;
+		size_t numReturnVariables = 0;
+		/// Number of slots of a call frame: parameters, return variables and all local variables.
+		size_t numSlots = 0;
+	};
+
+	EVMDialect const& m_dialect;
+	StatementCode m_code;
+	/// Number of slots used by variables outside of functions.
+	size_t m_numSlots = 0;
+	std::vector<Function> m_functions;
+};
+
+}
@@ -27,6 +27,7 @@
 #include <libyul/AST.h>
 #include <libyul/Utilities.h>
 
+#include <libevmasm/GasMeter.h>
 #include <libevmasm/Instruction.h>
 #include <libevmasm/SemanticInformation.h>
 
@@ -35,6 +36,7 @@
 #include <libsolutil/Numeric.h>
 #include <libsolutil/picosha2.h>
 
+#include <algorithm>
 #include <limits>
 
 using namespace solidity;
@@ -78,31 +80,33 @@ namespace solidity::yul::test
 {
 
 void copyZeroExtended(
-	std::map<u256, uint8_t>& _target,
+	InterpreterMemory& _target,
 	bytes const& _source,
 	size_t _targetOffset,
 	size_t _sourceOffset,
 	size_t _size
 )
 {
-	for (size_t i = 0; i < _size; ++i)
-		_target[_targetOffset + i] = (_sourceOffset + i < _source.size() ? _source[_sourceOffset + i] : 0);
+	size_t available =
+		_sourceOffset < _source.size() ?
+		std::min(_size, _source.size() - _sourceOffset) :
+		0;
+	if (available > 0)
+		_target.write(_targetOffset, _source.data() + _sourceOffset, available);
+	_target.fill(u256(_targetOffset) + available, _size - available);
 }
 
 void copyZeroExtendedWithOverlap(
-	std::map<u256, uint8_t>& _target,
-	std::map<u256, uint8_t> const& _source,
+	InterpreterMemory& _target,
+	InterpreterMemory const& _source,
 	size_t _targetOffset,
 	size_t _sourceOffset,
 	size_t _size
 )
 {
-	if (_targetOffset >= _sourceOffset)
-		for (size_t i = _size; i > 0; --i)
-			_target[_targetOffset + i - 1] = (_source.count(_sourceOffset + i - 1) != 0 ? _source.at(_sourceOffset + i - 1) : 0);
-	else
-		for (size_t i = 0; i < _size; ++i)
-			_target[_targetOffset + i] = (_source.count(_sourceOffset + i) != 0 ? _source.at(_sourceOffset + i) : 0);
+	// Reading the whole source range first gives the semantics of an intermediate buffer.
+	bytes data = _source.read(_sourceOffset, _size);
+	_target.write(_targetOffset, data.data(), data.size());
 }
 
 }
@@ -118,6 +122,8 @@ u256 EVMInstructionInterpreter::eval(
 	auto info = instructionInfo(_instruction, m_evmVersion);
 	yulAssert(static_cast<size_t>(info.args) == _arguments.size(), "");
 
+	m_state.gasUsed += staticGasCost(_instruction, m_evmVersion);
+
 	auto const& arg = _arguments;
 	switch (_instruction)
 	{
@@ -316,7 +322,7 @@ u256 EVMInstructionInterpreter::eval(
 		return 0;
 	case Instruction::MSTORE8:
 		accessMemory(arg[0], 1);
-		m_state.memory[arg[0]] = uint8_t(arg[1] & 0xff);
+		m_state.memory.set(arg[0], uint8_t(arg[1] & 0xff));
 		return 0;
 	case Instruction::SLOAD:
 		return m_state.storage[h256(arg[0])];
@@ -568,6 +574,50 @@ u256 EVMInstructionInterpreter::evalBuiltin(
 	yulAssert(false, "Unknown builtin: " + fun);
 }
 
+u256 EVMInstructionInterpreter::staticGasCost(evmasm::Instruction _instruction, langutil::EVMVersion _evmVersion)
+{
+	using evmasm::Instruction;
+
+	Tier const tier = instructionInfo(_instruction, _evmVersion).gasPriceTier;
+	if (tier != Tier::Special && tier != Tier::Invalid)
+		return evmasm::GasMeter::runGas(_instruction, _evmVersion);
+
+	switch (_instruction)
+	{
+	case Instruction::EXP:
+		return GasCosts::expGas + GasCosts::expByteGas(_evmVersion);
+	case Instruction::KECCAK256:
+		return GasCosts::keccak256Gas;
+	case Instruction::SLOAD:
+		return GasCosts::sloadGas(_evmVersion);
+	case Instruction::SSTORE:
+		return GasCosts::totalSstoreResetGas(_evmVersion);
+	case Instruction::BALANCE:
+		return GasCosts::balanceGas(_evmVersion);
+	case Instruction::EXTCODESIZE:
+	case Instruction::EXTCODECOPY:
+	case Instruction::EXTCODEHASH:
+		return GasCosts::extCodeGas(_evmVersion);
+	case Instruction::CALL:
+	case Instruction::CALLCODE:
+	case Instruction::DELEGATECALL:
+	case Instruction::STATICCALL:
+		return GasCosts::callGas(_evmVersion);
+	case Instruction::CREATE:
+	case Instruction::CREATE2:
+		return GasCosts::createGas;
+	case Instruction::LOG0:
+	case Instruction::LOG1:
+	case Instruction::LOG2:
+	case Instruction::LOG3:
+	case Instruction::LOG4:
+		return GasCosts::logGas + GasCosts::logTopicGas * getLogNumber(_instruction);
+	case Instruction::SELFDESTRUCT:
+		return GasCosts::selfdestructGas(_evmVersion);
+	default:
+		return 0;
+	}
+}
 
 bool EVMInstructionInterpreter::accessMemory(u256 const& _offset, u256 const& _size)
 {
@@ -590,10 +640,7 @@ bool EVMInstructionInterpreter::accessMemory(u256 const& _offset, u256 const& _s
 bytes EVMInstructionInterpreter::readMemory(u256 const& _offset, u256 const& _size)
 {
 	yulAssert(_size <= s_maxRangeSize, "Too large read.");
-	bytes data(size_t(_size), uint8_t(0));
-	for (size_t i = 0; i < data.size(); ++i)
-		data[i] = m_state.memory[_offset + i];
-	return data;
+	return m_state.memory.read(_offset, size_t(_size));
 }
 
 u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
@@ -603,8 +650,7 @@ u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
 
 void EVMInstructionInterpreter::writeMemoryWord(u256 const& _offset, u256 const& _value)
 {
-	for (size_t i = 0; i < 32; i++)
-		m_state.memory[_offset + i] = uint8_t((_value >> (8 * (31 - i))) & 0xff);
+	m_state.memory.writeWord(_offset, _value);
 }
 
 
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <test/tools/yulInterpreter/Memory.h>
+
 #include <libyul/ASTForward.h>
 
 #include <libsolutil/CommonData.h>
@@ -49,7 +51,7 @@ namespace solidity::yul::test
 /// @a _target at offset @a _targetOffset. Behaves as if @a _source would
 /// continue with an infinite sequence of zero bytes beyond its end.
 void copyZeroExtended(
-	std::map<u256, uint8_t>& _target,
+	InterpreterMemory& _target,
 	bytes const& _source,
 	size_t _targetOffset,
 	size_t _sourceOffset,
@@ -62,8 +64,8 @@ void copyZeroExtended(
 /// When target and source areas overlap, behaves as if the data was copied
 /// using an intermediate buffer.
 void copyZeroExtendedWithOverlap(
-	std::map<u256, uint8_t>& _target,
-	std::map<u256, uint8_t> const& _source,
+	InterpreterMemory& _target,
+	InterpreterMemory const& _source,
 	size_t _targetOffset,
 	size_t _sourceOffset,
 	size_t _size
@@ -110,6 +112,10 @@ public:
 	/// @returns the blob versioned hash
 	util::h256 blobHash(u256 const& _index);
 
+	/// @returns an approximation of the gas charged for executing @a _instruction, not
+	/// including any costs that depend on the arguments (memory expansion, copy costs etc.).
+	static u256 staticGasCost(evmasm::Instruction _instruction, langutil::EVMVersion _evmVersion);
+
 private:
 	/// Checks if the memory access is valid and adjusts msize accordingly.
 	/// @returns true if memory access is valid, false otherwise
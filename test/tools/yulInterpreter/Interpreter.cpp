@@ -41,20 +41,46 @@ using namespace solidity;
 using namespace solidity::yul;
 using namespace solidity::yul::test;
 
+using solidity::evmasm::Instruction;
 using solidity::util::h256;
 
-void InterpreterState::dumpStorage(std::ostream& _out) const
+namespace
+{
+
+/// Adds the costs of the given instructions, used by the EVM code transform to implement
+/// control flow (jumps and comparisons), to the gas consumption recorded in @a _state.
+void chargeControlFlowGas(
+	InterpreterState& _state,
+	Dialect const& _dialect,
+	std::initializer_list<Instruction> _instructions
+)
+{
+	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect))
+		for (Instruction instruction: _instructions)
+			_state.gasUsed += EVMInstructionInterpreter::staticGasCost(instruction, evmDialect->evmVersion());
+}
+
+/// Prints the non-zero slots of @a _storage to @a _out, ordered by slot.
+void dumpSortedStorage(std::ostream& _out, InterpreterStorage const& _storage)
 {
-	for (auto const& [slot, value]: storage)
+	std::map<h256, h256> sorted;
+	for (auto const& [slot, value]: _storage)
 		if (value != h256{})
-			_out << "  " << slot.hex() << ": " << value.hex() << std::endl;
+			sorted.emplace(slot, value);
+	for (auto const& [slot, value]: sorted)
+		_out << "  " << slot.hex() << ": " << value.hex() << std::endl;
+}
+
+}
+
+void InterpreterState::dumpStorage(std::ostream& _out) const
+{
+	dumpSortedStorage(_out, storage);
 }
 
 void InterpreterState::dumpTransientStorage(std::ostream& _out) const
 {
-	for (auto const& [slot, value]: transientStorage)
-		if (value != h256{})
-			_out << "  " << slot.hex() << ": " << value.hex() << std::endl;
+	dumpSortedStorage(_out, transientStorage);
 }
 
 void InterpreterState::dumpTraceAndState(std::ostream& _out, bool _disableMemoryTrace) const
@@ -65,12 +91,20 @@ void InterpreterState::dumpTraceAndState(std::ostream& _out, bool _disableMemory
 	if (!_disableMemoryTrace)
 	{
 		_out << "Memory dump:\n";
-		std::map<u256, u256> words;
-		for (auto const& [offset, value]: memory)
-			words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * static_cast<size_t>(offset % 0x20));
-		for (auto const& [offset, value]: words)
-			if (value != 0)
-				_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << std::endl;
+		// Pages are aligned to words, so every word lies within a single page.
+		static_assert(InterpreterMemory::pageSize % 0x20 == 0);
+		for (auto const& [pageStart, page]: memory.pages())
+			for (size_t wordOffset = 0; wordOffset < page.size(); wordOffset += 0x20)
+			{
+				h256 word(bytes(page.data() + wordOffset, page.data() + wordOffset + 0x20));
+				if (word != h256{})
+					_out <<
+						"  " <<
+						std::uppercase << std::hex << std::setw(4) << u256(pageStart + wordOffset) <<
+						": " <<
+						word.hex() <<
+						std::endl;
+			}
 	}
 	_out << "Storage dump:" << std::endl;
 	dumpStorage(_out);
@@ -155,6 +189,7 @@ void Interpreter::operator()(VariableDeclaration const& _declaration)
 void Interpreter::operator()(If const& _if)
 {
 	solAssert(_if.condition, "");
+	chargeControlFlowGas(m_state, m_dialect, {Instruction::ISZERO, Instruction::JUMPI, Instruction::JUMPDEST});
 	if (evaluate(*_if.condition) != 0)
 		(*this)(_if.body);
 }
@@ -165,12 +200,17 @@ void Interpreter::operator()(Switch const& _switch)
 	u256 val = evaluate(*_switch.expression);
 	solAssert(!_switch.cases.empty(), "");
 	for (auto const& c: _switch.cases)
+	{
+		if (c.value)
+			chargeControlFlowGas(m_state, m_dialect, {Instruction::DUP1, Instruction::EQ, Instruction::JUMPI});
 		// Default case has to be last.
 		if (!c.value || evaluate(*c.value) == val)
 		{
+			chargeControlFlowGas(m_state, m_dialect, {Instruction::JUMPDEST});
 			(*this)(c.body);
 			break;
 		}
+	}
 }
 
 void Interpreter::operator()(FunctionDefinition const&)
@@ -190,8 +230,12 @@ void Interpreter::operator()(ForLoop const& _forLoop)
 		if (m_state.controlFlowState == ControlFlowState::Leave)
 			return;
 	}
-	while (evaluate(*_forLoop.condition) != 0)
+	while (true)
 	{
+		chargeControlFlowGas(m_state, m_dialect, {Instruction::ISZERO, Instruction::JUMPI});
+		if (evaluate(*_forLoop.condition) == 0)
+			break;
+
 		// Increment step for each loop iteration for loops with
 		// an empty body and post blocks to prevent a deadlock.
 		if (_forLoop.body.statements.size() == 0 && _forLoop.post.statements.size() == 0)
@@ -206,6 +250,7 @@ void Interpreter::operator()(ForLoop const& _forLoop)
 		(*this)(_forLoop.post);
 		if (m_state.controlFlowState == ControlFlowState::Leave)
 			break;
+		chargeControlFlowGas(m_state, m_dialect, {Instruction::JUMP, Instruction::JUMPDEST});
 	}
 	if (m_state.controlFlowState != ControlFlowState::Leave)
 		m_state.controlFlowState = ControlFlowState::Default;
@@ -349,6 +394,12 @@ void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 	for (size_t i = 0; i < fun->returnVariables.size(); ++i)
 		variables[fun->returnVariables.at(i).name] = 0;
 
+	// Pushing the return label, jumping into the function and jumping back.
+	chargeControlFlowGas(
+		m_state,
+		m_dialect,
+		{Instruction::PUSH1, Instruction::JUMP, Instruction::JUMPDEST, Instruction::JUMP, Instruction::JUMPDEST}
+	);
 	m_state.controlFlowState = ControlFlowState::Default;
 	std::unique_ptr<Interpreter> interpreter = makeInterpreterCopy(std::move(variables));
 	(*interpreter)(fun->body);
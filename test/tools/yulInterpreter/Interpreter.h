@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <test/tools/yulInterpreter/Memory.h>
+
 #include <libyul/ASTForward.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/optimiser/ASTWalker.h>
@@ -32,7 +34,10 @@
 
 #include <libsolutil/Exceptions.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <map>
+#include <unordered_map>
 
 namespace solidity::yul
 {
@@ -74,15 +79,32 @@ enum class ControlFlowState
 	Leave
 };
 
+/// Hash function for storage slots. Slots are mostly small numbers or keccak256 outputs,
+/// so hashing all bytes gives a good spread in both cases.
+struct StorageSlotHash
+{
+	size_t operator()(util::h256 const& _slot) const
+	{
+		return boost::hash_range(_slot.data(), _slot.data() + util::h256::size);
+	}
+};
+
+/// Storage is only accessed by key during execution, ordering is only established when dumping.
+using InterpreterStorage = std::unordered_map<util::h256, util::h256, StorageSlotHash>;
+
 struct InterpreterState
 {
 	bytes calldata;
 	bytes returndata;
-	std::map<u256, uint8_t> memory;
+	InterpreterMemory memory;
 	/// This is different than memory.size() because we ignore gas.
 	u256 msize;
-	std::map<util::h256, util::h256> storage;
-	std::map<util::h256, util::h256> transientStorage;
+	/// Approximate amount of gas consumed so far. Only accounts for the static part of
+	/// instruction costs and for the jumps needed to implement control flow, i.e. ignores
+	/// memory expansion, cold/warm access distinction, refunds and stack manipulation.
+	u256 gasUsed = 0;
+	InterpreterStorage storage;
+	InterpreterStorage transientStorage;
 	util::h160 address = util::h160("0x0000000000000000000000000000000011111111");
 	u256 balance = 0x22222222;
 	u256 selfbalance = 0x22223333;
@@ -133,10 +155,7 @@ struct InterpreterState
 	bytes readMemory(u256 const& _offset, u256 const& _size)
 	{
 		yulAssert(_size <= 0xffff, "Too large read.");
-		bytes data(size_t(_size), uint8_t(0));
-		for (size_t i = 0; i < data.size(); ++i)
-			data[i] = memory[_offset + i];
-		return data;
+		return memory.read(_offset, size_t(_size));
 	}
 };
 
@@ -0,0 +1,115 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Memory model of the Yul interpreter.
+ */
+
+#include <test/tools/yulInterpreter/Memory.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <algorithm>
+
+using namespace solidity;
+using namespace solidity::yul::test;
+
+template <typename Visitor>
+void InterpreterMemory::forEachPageRun(u256 const& _offset, size_t _size, Visitor&& _visitor)
+{
+	size_t done = 0;
+	u256 address = _offset;
+	while (done < _size)
+	{
+		size_t inPage = static_cast<size_t>(address % pageSize);
+		size_t length = std::min(pageSize - inPage, _size - done);
+		// Wraps around at 2**256 just like the address itself.
+		_visitor(u256(address - inPage), inPage, done, length);
+		done += length;
+		address += length;
+	}
+}
+
+uint8_t InterpreterMemory::get(u256 const& _offset) const
+{
+	size_t inPage = static_cast<size_t>(_offset % pageSize);
+	auto it = m_pages.find(_offset - inPage);
+	return it == m_pages.end() ? 0 : it->second[inPage];
+}
+
+void InterpreterMemory::set(u256 const& _offset, uint8_t _value)
+{
+	size_t inPage = static_cast<size_t>(_offset % pageSize);
+	m_pages[_offset - inPage][inPage] = _value;
+}
+
+bytes InterpreterMemory::read(u256 const& _offset, size_t _size) const
+{
+	bytes data(_size, 0);
+	forEachPageRun(
+		_offset,
+		_size,
+		[&](u256 const& _pageStart, size_t _inPage, size_t _done, size_t _length)
+		{
+			auto it = m_pages.find(_pageStart);
+			if (it != m_pages.end())
+				std::copy_n(it->second.data() + _inPage, _length, data.data() + _done);
+		}
+	);
+	return data;
+}
+
+void InterpreterMemory::write(u256 const& _offset, uint8_t const* _data, size_t _size)
+{
+	forEachPageRun(
+		_offset,
+		_size,
+		[&](u256 const& _pageStart, size_t _inPage, size_t _done, size_t _length)
+		{
+			// Newly created pages are value-initialised, i.e. zero.
+			Page& page = m_pages[_pageStart];
+			std::copy_n(_data + _done, _length, page.data() + _inPage);
+		}
+	);
+}
+
+void InterpreterMemory::fill(u256 const& _offset, size_t _size)
+{
+	forEachPageRun(
+		_offset,
+		_size,
+		[&](u256 const& _pageStart, size_t _inPage, size_t, size_t _length)
+		{
+			// Pages that do not exist yet already read as zero.
+			auto it = m_pages.find(_pageStart);
+			if (it != m_pages.end())
+				std::fill_n(it->second.data() + _inPage, _length, uint8_t(0));
+		}
+	);
+}
+
+u256 InterpreterMemory::readWord(u256 const& _offset) const
+{
+	bytes word = read(_offset, 32);
+	return u256(util::h256(word));
+}
+
+void InterpreterMemory::writeWord(u256 const& _offset, u256 const& _value)
+{
+	util::h256 word(_value);
+	write(_offset, word.data(), 32);
+}
@@ -0,0 +1,80 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Memory model of the Yul interpreter.
+ */
+
+#pragma once
+
+#include <libsolutil/Common.h>
+#include <libsolutil/Numeric.h>
+
+#include <array>
+#include <map>
+
+namespace solidity::yul::test
+{
+
+/**
+ * Sparse, byte-addressable memory spanning the whole 256-bit address space.
+ *
+ * Bytes are stored in fixed-size pages that are allocated on first write, so that
+ * word-sized and bulk accesses touch a single page lookup instead of one map node per byte.
+ * Bytes that have never been written read as zero. Addresses wrap around modulo 2**256,
+ * exactly like the byte-wise map this class replaces.
+ */
+class InterpreterMemory
+{
+public:
+	static constexpr size_t pageSize = 4096;
+	using Page = std::array<uint8_t, pageSize>;
+
+	/// @returns the byte stored at @a _offset or zero if it was never written.
+	uint8_t get(u256 const& _offset) const;
+	void set(u256 const& _offset, uint8_t _value);
+
+	/// @returns @a _size bytes starting at @a _offset.
+	bytes read(u256 const& _offset, size_t _size) const;
+	/// Stores @a _size bytes from @a _data starting at @a _offset.
+	void write(u256 const& _offset, uint8_t const* _data, size_t _size);
+	/// Stores @a _size zero bytes starting at @a _offset.
+	void fill(u256 const& _offset, size_t _size);
+
+	/// @returns the big-endian 32-byte word starting at @a _offset.
+	u256 readWord(u256 const& _offset) const;
+	/// Stores @a _value as a big-endian 32-byte word starting at @a _offset.
+	void writeWord(u256 const& _offset, u256 const& _value);
+
+	/// @returns all allocated pages, ordered by the address of their first byte.
+	/// Page contents that were never written are zero.
+	std::map<u256, Page> const& pages() const { return m_pages; }
+	bool empty() const { return m_pages.empty(); }
+	void clear() { m_pages.clear(); }
+
+private:
+	/// Calls @a _visitor for each maximal run of the address range [_offset, _offset + _size)
+	/// that lies within a single page, passing the start address of the page, the offset
+	/// inside the page, the offset relative to @a _offset and the length of the run.
+	template <typename Visitor>
+	static void forEachPageRun(u256 const& _offset, size_t _size, Visitor&& _visitor);
+
+	/// Pages keyed by the address of their first byte.
+	std::map<u256, Page> m_pages;
+};
+
+}
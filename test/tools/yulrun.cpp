@@ -19,6 +19,7 @@
  * Yul interpreter.
  */
 
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
 #include <test/tools/yulInterpreter/Interpreter.h>
 #include <test/tools/yulInterpreter/Inspector.h>
 
@@ -93,7 +94,7 @@ void interpret(std::string const& _source, bool _inspect, bool _disableExternalC
 		if (_inspect)
 			InspectedInterpreter::run(std::make_shared<Inspector>(_source, state), state, *ast, _disableExternalCalls, /*disableMemoryTracing=*/false);
 		else
-			Interpreter::run(state, *ast, _disableExternalCalls, /*disableMemoryTracing=*/false);
+			CompiledInterpreter::run(state, *ast, _disableExternalCalls, /*disableMemoryTracing=*/false);
 	}
 	catch (InterpreterTerminatedGeneric const&)
 	{
@@ -237,6 +237,56 @@ BOOST_FIXTURE_TEST_CASE(evaluate_should_multiply_the_result_by_scaling_factor, P
 	BOOST_TEST(RelativeProgramSize(m_program, nullptr, 4, m_weights).evaluate(m_chromosome) == round(10000.0 * sizeRatio));
 }
 
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(ProgramGasCostTest)
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_combine_execution_gas_of_the_optimised_program_with_its_size, ProgramBasedMetricFixture)
+{
+	ProgramGasCost metric(m_program, nullptr, {}, 10, 1000, m_weights);
+	size_t fitness = metric.evaluate(m_chromosome);
+
+	BOOST_TEST(metric.executionGas(m_optimisedProgram) > 0);
+	BOOST_TEST(fitness == size_t(metric.executionGas(m_optimisedProgram)) * 10 + m_optimisedProgram.codeSize(m_weights) * 200);
+}
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_be_able_to_use_program_cache_if_available, ProgramBasedMetricFixture)
+{
+	ProgramGasCost metric(std::nullopt, m_programCache, {}, 10, 1000, m_weights);
+	size_t fitness = metric.evaluate(m_chromosome);
+
+	BOOST_TEST(fitness == size_t(metric.executionGas(m_optimisedProgram)) * 10 + m_optimisedProgram.codeSize(m_weights) * 200);
+	BOOST_TEST(m_programCache->size() == m_chromosome.length());
+}
+
+BOOST_FIXTURE_TEST_CASE(executionGas_should_depend_on_call_data, ProgramBasedMetricFixture)
+{
+	CharStream sourceStream = CharStream("{ if calldataload(0) { sstore(0, 1) } }", "");
+	Program program = std::get<Program>(Program::load(sourceStream));
+
+	bytes nonZeroInput(32, 0);
+	nonZeroInput[31] = 1;
+
+	u256 gasWithoutStore = ProgramGasCost(program, nullptr, {bytes(32, 0)}, 1, 1000, m_weights).executionGas(program);
+	u256 gasWithStore = ProgramGasCost(program, nullptr, {nonZeroInput}, 1, 1000, m_weights).executionGas(program);
+	u256 gasForBoth = ProgramGasCost(program, nullptr, {bytes(32, 0), nonZeroInput}, 1, 1000, m_weights).executionGas(program);
+
+	BOOST_TEST(gasWithoutStore > 0);
+	BOOST_TEST(gasWithStore > gasWithoutStore);
+	BOOST_TEST((gasForBoth == gasWithoutStore + gasWithStore));
+}
+
+BOOST_FIXTURE_TEST_CASE(executionGas_should_stop_at_step_limit, ProgramBasedMetricFixture)
+{
+	CharStream sourceStream = CharStream("{ for {} 1 {} { mstore(0, 1) } }", "");
+	Program program = std::get<Program>(Program::load(sourceStream));
+
+	u256 shortRunGas = ProgramGasCost(program, nullptr, {}, 1, 100, m_weights).executionGas(program);
+	u256 longRunGas = ProgramGasCost(program, nullptr, {}, 1, 1000, m_weights).executionGas(program);
+
+	BOOST_TEST(shortRunGas > 0);
+	BOOST_TEST(longRunGas > shortRunGas);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(FitnessMetricCombinationTest)
 
@@ -88,6 +88,9 @@ protected:
 		/* metricAggregator = */ MetricAggregatorChoice::Average,
 		/* relativeMetricScale = */ 5,
 		/* chromosomeRepetitions = */ 1,
+		/* callInputs = */ {},
+		/* optimiseRuns = */ 200,
+		/* maxExecutionSteps = */ 1000,
 	};
 	CodeWeights const m_weights{};
 };
@@ -236,6 +239,29 @@ BOOST_FIXTURE_TEST_CASE(build_should_set_relative_metric_scale, FitnessMetricFac
 	BOOST_TEST(relativeProgramSizeMetric->fixedPointPrecision() == m_options.relativeMetricScale);
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_pass_execution_options_to_gas_metric, FitnessMetricFactoryFixture)
+{
+	m_options.metric = MetricChoice::Gas;
+	m_options.metricAggregator = MetricAggregatorChoice::Average;
+	m_options.callInputs = {fromHex("0x12345678"), {}};
+	m_options.optimiseRuns = 1000;
+	m_options.maxExecutionSteps = 50;
+	std::unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(m_options, {m_programs[0]}, {nullptr}, m_weights);
+	BOOST_REQUIRE(metric != nullptr);
+
+	auto averageMetric = dynamic_cast<FitnessMetricAverage*>(metric.get());
+	BOOST_REQUIRE(averageMetric != nullptr);
+	BOOST_REQUIRE(averageMetric->metrics().size() == 1);
+	BOOST_REQUIRE(averageMetric->metrics()[0] != nullptr);
+
+	auto gasMetric = dynamic_cast<ProgramGasCost*>(averageMetric->metrics()[0].get());
+	BOOST_REQUIRE(gasMetric != nullptr);
+	BOOST_TEST((gasMetric->callInputs() == m_options.callInputs));
+	BOOST_TEST(gasMetric->optimiseRuns() == m_options.optimiseRuns);
+	BOOST_TEST(gasMetric->maxSteps() == m_options.maxExecutionSteps);
+	BOOST_TEST(toString(gasMetric->program()) == toString(m_programs[0]));
+}
+
 BOOST_FIXTURE_TEST_CASE(build_should_create_metric_for_each_input_program, FitnessMetricFactoryFixture)
 {
 	std::unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(
@@ -386,7 +412,7 @@ BOOST_AUTO_TEST_SUITE(ProgramCacheFactoryTest)
 
 BOOST_FIXTURE_TEST_CASE(build_should_create_cache_for_each_input_program_if_cache_enabled, FixtureWithPrograms)
 {
-	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true};
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true, /* maxProgramCacheSize = */ 0};
 	std::vector<std::shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
 	assert(m_programs.size() >= 2 && "There must be at least 2 programs for this test to be meaningful");
 
@@ -398,9 +424,22 @@ BOOST_FIXTURE_TEST_CASE(build_should_create_cache_for_each_input_program_if_cach
 	}
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_pass_size_limit_to_caches, FixtureWithPrograms)
+{
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true, /* maxProgramCacheSize = */ 1000};
+	std::vector<std::shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
+
+	BOOST_TEST(caches.size() == m_programs.size());
+	for (size_t i = 0; i < m_programs.size(); ++i)
+	{
+		BOOST_REQUIRE(caches[i] != nullptr);
+		BOOST_TEST(caches[i]->maxTotalCodeSize() == 1000);
+	}
+}
+
 BOOST_FIXTURE_TEST_CASE(build_should_return_nullptr_for_each_input_program_if_cache_disabled, FixtureWithPrograms)
 {
-	ProgramCacheFactory::Options options{/* programCacheEnabled = */ false};
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ false, /* maxProgramCacheSize = */ 0};
 	std::vector<std::shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
 	assert(m_programs.size() >= 2 && "There must be at least 2 programs for this test to be meaningful");
 
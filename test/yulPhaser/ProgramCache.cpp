@@ -212,6 +212,49 @@ BOOST_FIXTURE_TEST_CASE(startRound_should_remove_entries_older_than_two_rounds,
 	BOOST_TEST(m_programCache.size() == 0);
 }
 
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_evict_least_recently_used_entries_when_over_size_limit, ProgramCacheFixture)
+{
+	size_t sizeI = optimisedProgram(m_program, "I").codeSize(CacheStats::StorageWeights);
+	size_t sizeIu = optimisedProgram(m_program, "Iu").codeSize(CacheStats::StorageWeights);
+	size_t sizeL = optimisedProgram(m_program, "L").codeSize(CacheStats::StorageWeights);
+	size_t sizeLT = optimisedProgram(m_program, "LT").codeSize(CacheStats::StorageWeights);
+
+	// Enough to store everything except for one entry.
+	ProgramCache cache(m_program, sizeI + sizeIu + sizeL + sizeLT - 1);
+
+	cache.optimiseProgram("Iu");
+	BOOST_REQUIRE((cachedKeys(cache) == std::set<std::string>{"I", "Iu"}));
+	BOOST_TEST(cache.gatherStats().totalCodeSize == sizeI + sizeIu);
+
+	cache.optimiseProgram("L");
+	BOOST_REQUIRE((cachedKeys(cache) == std::set<std::string>{"I", "Iu", "L"}));
+
+	// "I" and "Iu" are the least recently used. "Iu" is longer so it goes first.
+	cache.optimiseProgram("LT");
+	BOOST_TEST((cachedKeys(cache) == std::set<std::string>{"I", "L", "LT"}));
+	BOOST_TEST(cache.gatherStats().totalCodeSize == sizeI + sizeL + sizeLT);
+	BOOST_TEST(cache.gatherStats().totalCodeSize <= cache.maxTotalCodeSize());
+}
+
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_return_optimised_program_even_if_it_does_not_fit_in_cache, ProgramCacheFixture)
+{
+	ProgramCache cache(m_program, 1);
+
+	Program cachedProgram = cache.optimiseProgram("IuO");
+
+	BOOST_TEST(toString(cachedProgram) == toString(optimisedProgram(m_program, "IuO")));
+	BOOST_TEST(cache.size() == 0);
+	BOOST_TEST(cache.gatherStats().totalCodeSize == 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_not_evict_anything_without_size_limit, ProgramCacheFixture)
+{
+	m_programCache.optimiseProgram("IuO");
+	m_programCache.optimiseProgram("LT");
+
+	BOOST_TEST((cachedKeys(m_programCache) == std::set<std::string>{"I", "Iu", "IuO", "L", "LT"}));
+}
+
 BOOST_FIXTURE_TEST_CASE(gatherStats_should_return_cache_statistics, ProgramCacheFixture)
 {
 	size_t sizeI = optimisedProgram(m_program, "I").codeSize(CacheStats::StorageWeights);
@@ -18,10 +18,16 @@
 
 #include <tools/yulPhaser/FitnessMetrics.h>
 
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
+
+#include <libevmasm/GasMeter.h>
+
 #include <libsolutil/CommonIO.h>
 
 #include <cmath>
+#include <limits>
 
+using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::yul;
 using namespace solidity::phaser;
@@ -74,6 +80,57 @@ size_t RelativeProgramSize::evaluate(Chromosome const& _chromosome)
 	));
 }
 
+size_t ProgramGasCost::evaluate(Chromosome const& _chromosome)
+{
+	Program optimised = optimisedProgram(_chromosome);
+
+	bigint const runtimeGas = bigint(executionGas(optimised)) * m_optimiseRuns;
+	bigint const deploymentGas = bigint(optimised.codeSize(codeWeights())) * evmasm::GasCosts::createDataGas;
+	bigint const totalGas = runtimeGas + deploymentGas;
+
+	if (totalGas > std::numeric_limits<size_t>::max())
+		return std::numeric_limits<size_t>::max();
+	return static_cast<size_t>(totalGas);
+}
+
+u256 ProgramGasCost::executionGas(Program const& _program) const
+{
+	// Lower the code only once and reuse it for all the inputs.
+	yul::test::CompiledInterpreter interpreter(_program.ast(), _program.dialect());
+	if (m_callInputs.empty())
+		return executionGas(interpreter, {});
+
+	u256 total = 0;
+	for (bytes const& callData: m_callInputs)
+		total += executionGas(interpreter, callData);
+	return total;
+}
+
+u256 ProgramGasCost::executionGas(
+	yul::test::CompiledInterpreter const& _interpreter,
+	bytes const& _callData
+) const
+{
+	yul::test::InterpreterState state;
+	state.calldata = _callData;
+	state.maxSteps = m_maxSteps;
+
+	try
+	{
+		_interpreter(
+			state,
+			true, // _disableExternalCalls
+			true // _disableMemoryTracing
+		);
+	}
+	catch (yul::test::InterpreterTerminatedGeneric const&)
+	{
+		// Covers both explicit termination (return, revert, stop, ...) and hitting the step limit.
+	}
+
+	return state.gasUsed;
+}
+
 size_t FitnessMetricAverage::evaluate(Chromosome const& _chromosome)
 {
 	assert(m_metrics.size() > 0);
@@ -27,8 +27,16 @@
 
 #include <libyul/optimiser/Metrics.h>
 
+#include <libsolutil/Common.h>
+
 #include <cstddef>
 #include <optional>
+#include <vector>
+
+namespace solidity::yul::test
+{
+class CompiledInterpreter;
+}
 
 namespace solidity::phaser
 {
@@ -132,6 +140,54 @@ private:
 	size_t m_fixedPointPrecision;
 };
 
+/**
+ * Fitness metric based on the gas needed to deploy a specific program and to execute it
+ * after applying the optimisations from the chromosome to it.
+ *
+ * The program is executed in the Yul interpreter once for each of the recorded call inputs (or
+ * once with empty calldata if there are none) and the interpreter's approximation of the runtime
+ * gas is summed up. The size of the program is converted to gas by treating each unit of
+ * @a CodeSize as one byte of deployed bytecode. The two are combined the same way the optimiser
+ * does it for ``--optimize-runs``: the execution cost is multiplied by the expected number of runs
+ * and then the deployment cost is added.
+ *
+ * Executions that do not terminate within @a _maxSteps interpreter steps are cut off at that
+ * point and contribute the gas consumed up to it.
+ */
+class ProgramGasCost: public ProgramBasedMetric
+{
+public:
+	explicit ProgramGasCost(
+		std::optional<Program> _program,
+		std::shared_ptr<ProgramCache> _programCache,
+		std::vector<bytes> _callInputs,
+		size_t _optimiseRuns,
+		size_t _maxSteps,
+		yul::CodeWeights const& _weights,
+		size_t _repetitionCount = 1
+	):
+		ProgramBasedMetric(std::move(_program), std::move(_programCache), _weights, _repetitionCount),
+		m_callInputs(std::move(_callInputs)),
+		m_optimiseRuns(_optimiseRuns),
+		m_maxSteps(_maxSteps) {}
+
+	std::vector<bytes> const& callInputs() const { return m_callInputs; }
+	size_t optimiseRuns() const { return m_optimiseRuns; }
+	size_t maxSteps() const { return m_maxSteps; }
+
+	size_t evaluate(Chromosome const& _chromosome) override;
+
+	/// @returns the total gas used by executing @a _program once for each of the call inputs.
+	u256 executionGas(Program const& _program) const;
+
+private:
+	u256 executionGas(yul::test::CompiledInterpreter const& _interpreter, bytes const& _callData) const;
+
+	std::vector<bytes> m_callInputs;
+	size_t m_optimiseRuns;
+	size_t m_maxSteps;
+};
+
 /**
  * Abstract base class for fitness metrics that compute their value based on values of multiple
  * other, nested metrics.
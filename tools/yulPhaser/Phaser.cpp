@@ -68,6 +68,7 @@ std::map<MetricChoice, std::string> MetricChoiceToStringMap =
 {
 	{MetricChoice::CodeSize, "code-size"},
 	{MetricChoice::RelativeCodeSize, "relative-code-size"},
+	{MetricChoice::Gas, "gas"},
 };
 std::map<std::string, MetricChoice> const StringToMetricChoiceMap = invertMap(MetricChoiceToStringMap);
 
@@ -213,11 +214,26 @@ CodeWeights CodeWeightFactory::buildFromCommandLine(po::variables_map const& _ar
 
 FitnessMetricFactory::Options FitnessMetricFactory::Options::fromCommandLine(po::variables_map const& _arguments)
 {
+	std::vector<bytes> callInputs;
+	if (_arguments.count("call-data") > 0)
+		for (std::string const& callData: _arguments["call-data"].as<std::vector<std::string>>())
+		{
+			assertThrow(
+				callData.empty() || isValidHex(callData),
+				BadInput,
+				"Call data must be a hex string starting with 0x: " + callData
+			);
+			callInputs.push_back(fromHex(callData));
+		}
+
 	return {
 		_arguments["metric"].as<MetricChoice>(),
 		_arguments["metric-aggregator"].as<MetricAggregatorChoice>(),
 		_arguments["relative-metric-scale"].as<size_t>(),
 		_arguments["chromosome-repetitions"].as<size_t>(),
+		std::move(callInputs),
+		_arguments["optimize-runs"].as<size_t>(),
+		_arguments["max-execution-steps"].as<size_t>(),
 	};
 }
 
@@ -258,6 +274,20 @@ std::unique_ptr<FitnessMetric> FitnessMetricFactory::build(
 				));
 			break;
 		}
+		case MetricChoice::Gas:
+		{
+			for (size_t i = 0; i < _programs.size(); ++i)
+				metrics.push_back(std::make_unique<ProgramGasCost>(
+					_programCaches[i] != nullptr ? std::optional<Program>{} : std::move(_programs[i]),
+					std::move(_programCaches[i]),
+					_options.callInputs,
+					_options.optimiseRuns,
+					_options.maxExecutionSteps,
+					_weights,
+					_options.chromosomeRepetitions
+				));
+			break;
+		}
 		default:
 			assertThrow(false, solidity::util::Exception, "Invalid MetricChoice value.");
 	}
@@ -360,6 +390,7 @@ ProgramCacheFactory::Options ProgramCacheFactory::Options::fromCommandLine(po::v
 {
 	return {
 		_arguments["program-cache"].as<bool>(),
+		_arguments["max-program-cache-size"].as<size_t>(),
 	};
 }
 
@@ -370,7 +401,11 @@ std::vector<std::shared_ptr<ProgramCache>> ProgramCacheFactory::build(
 {
 	std::vector<std::shared_ptr<ProgramCache>> programCaches;
 	for (Program& program: _programs)
-		programCaches.push_back(_options.programCacheEnabled ? std::make_shared<ProgramCache>(std::move(program)) : nullptr);
+		programCaches.push_back(
+			_options.programCacheEnabled ?
+			std::make_shared<ProgramCache>(std::move(program), _options.maxProgramCacheSize) :
+			nullptr
+		);
 
 	return programCaches;
 }
@@ -647,7 +682,8 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 				"\n"
 				"AVAILABLE METRICS:\n"
 				"* " + toString(MetricChoice::CodeSize) + "\n" +
-				"* " + toString(MetricChoice::RelativeCodeSize)
+				"* " + toString(MetricChoice::RelativeCodeSize) + "\n" +
+				"* " + toString(MetricChoice::Gas)
 			).c_str()
 		)
 		(
@@ -681,6 +717,34 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			po::value<size_t>()->value_name("<COUNT>")->default_value(1),
 			"Number of times to repeat the sequence optimisation steps represented by a chromosome."
 		)
+		(
+			"call-data",
+			po::value<std::vector<std::string>>()->multitoken()->value_name("<HEX>"),
+			(
+				"Call data (hex string starting with 0x) the program is executed with by the " +
+				toString(MetricChoice::Gas) + " metric. Can be given multiple times to execute the "
+				"program once for each input and sum up the gas. If not given, the program is executed "
+				"once with empty call data."
+			).c_str()
+		)
+		(
+			"optimize-runs",
+			po::value<size_t>()->value_name("<RUNS>")->default_value(200),
+			(
+				"Expected number of executions of the deployed program. The " +
+				toString(MetricChoice::Gas) + " metric weighs execution gas against the cost of "
+				"deploying the code the same way as the --optimize-runs option of the compiler."
+			).c_str()
+		)
+		(
+			"max-execution-steps",
+			po::value<size_t>()->value_name("<STEPS>")->default_value(100000),
+			(
+				"Maximum number of interpreter steps a single execution is allowed to take when "
+				"evaluating the " + toString(MetricChoice::Gas) + " metric. "
+				"Longer executions are cut off at that point."
+			).c_str()
+		)
 	;
 	keywordDescription.add(metricsDescription);
 
@@ -713,8 +777,15 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			po::bool_switch(),
 			"Enables caching of intermediate programs corresponding to chromosome prefixes.\n"
 			"This speeds up fitness evaluation by a lot but eats tons of memory if the chromosomes are long. "
-			"Disabled by default since there's currently no way to set an upper limit on memory usage but "
-			"highly recommended if your computer has enough RAM."
+			"Disabled by default but highly recommended if your computer has enough RAM. "
+			"Use --max-program-cache-size to put an upper limit on memory usage."
+		)
+		(
+			"max-program-cache-size",
+			po::value<size_t>()->value_name("<SIZE>")->default_value(0),
+			"Maximum total size of the programs stored in the cache of each input program, measured in AST "
+			"nodes. When the limit is exceeded, the least recently used programs are evicted. "
+			"0 means no limit."
 		)
 	;
 	keywordDescription.add(cacheDescription);
@@ -25,6 +25,8 @@
 #include <tools/yulPhaser/AlgorithmRunner.h>
 #include <tools/yulPhaser/GeneticAlgorithms.h>
 
+#include <libsolutil/Common.h>
+
 #include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 
@@ -34,6 +36,7 @@
 #include <optional>
 #include <ostream>
 #include <string>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -76,6 +79,7 @@ enum class MetricChoice
 {
 	CodeSize,
 	RelativeCodeSize,
+	Gas,
 };
 
 enum class MetricAggregatorChoice
@@ -158,6 +162,9 @@ public:
 		MetricAggregatorChoice metricAggregator;
 		size_t relativeMetricScale;
 		size_t chromosomeRepetitions;
+		std::vector<bytes> callInputs;
+		size_t optimiseRuns;
+		size_t maxExecutionSteps;
 
 		static Options fromCommandLine(boost::program_options::variables_map const& _arguments);
 	};
@@ -216,6 +223,7 @@ public:
 	struct Options
 	{
 		bool programCacheEnabled;
+		size_t maxProgramCacheSize;
 
 		static Options fromCommandLine(boost::program_options::variables_map const& _arguments);
 	};
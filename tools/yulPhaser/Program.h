@@ -77,6 +77,7 @@ public:
 
 	size_t codeSize(yul::CodeWeights const& _weights) const { return computeCodeSize(m_ast->root(), _weights); }
 	yul::Block const& ast() const { return m_ast->root(); }
+	yul::Dialect const& dialect() const { return m_dialect; }
 
 	friend std::ostream& operator<<(std::ostream& _stream, Program const& _program);
 	std::string toJson() const;
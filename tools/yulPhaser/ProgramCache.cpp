@@ -58,6 +58,8 @@ Program ProgramCache::optimiseProgram(
 	for (std::size_t i = 1; i < _repetitionCount; ++i)
 		targetOptimisations += _abbreviatedOptimisationSteps;
 
+	++m_accessCounter;
+
 	std::size_t prefixSize = 0;
 	for (std::size_t i = 1; i <= targetOptimisations.size(); ++i)
 	{
@@ -65,6 +67,7 @@ Program ProgramCache::optimiseProgram(
 		if (pair != m_entries.end())
 		{
 			pair->second.roundNumber = m_currentRound;
+			pair->second.lastAccess = m_accessCounter;
 			++prefixSize;
 			++m_hits;
 		}
@@ -83,10 +86,17 @@ Program ProgramCache::optimiseProgram(
 		std::string stepName = OptimiserSuite::stepAbbreviationToNameMap().at(targetOptimisations[i - 1]);
 		intermediateProgram.optimise({stepName});
 
-		m_entries.insert({targetOptimisations.substr(0, i), {intermediateProgram, m_currentRound}});
+		auto const& [pair, inserted] = m_entries.insert({
+			targetOptimisations.substr(0, i),
+			{intermediateProgram, m_currentRound, m_accessCounter}
+		});
+		assert(inserted);
+		m_totalCodeSize += pair->second.codeSize;
 		++m_misses;
 	}
 
+	evictEntries();
+
 	return intermediateProgram;
 }
 
@@ -100,7 +110,10 @@ void ProgramCache::startRound(std::size_t _roundNumber)
 		assert(pair->second.roundNumber < m_currentRound);
 
 		if (pair->second.roundNumber < m_currentRound - 1)
+		{
+			m_totalCodeSize -= pair->second.codeSize;
 			m_entries.erase(pair++);
+		}
 		else
 			++pair;
 	}
@@ -109,6 +122,7 @@ void ProgramCache::startRound(std::size_t _roundNumber)
 void ProgramCache::clear()
 {
 	m_entries.clear();
+	m_totalCodeSize = 0;
 	m_currentRound = 0;
 }
 
@@ -131,13 +145,29 @@ CacheStats ProgramCache::gatherStats() const
 	};
 }
 
-std::size_t ProgramCache::calculateTotalCachedCodeSize() const
+void ProgramCache::evictEntries()
 {
-	std::size_t size = 0;
-	for (auto const& pair: m_entries)
-		size += pair.second.program.codeSize(CacheStats::StorageWeights);
+	if (m_maxTotalCodeSize == 0)
+		return;
 
-	return size;
+	while (m_totalCodeSize > m_maxTotalCodeSize && !m_entries.empty())
+	{
+		// Using an entry also marks all its prefixes as used so among entries with the same access
+		// time evicting the longest one first guarantees that we never evict a prefix of an entry
+		// that stays in the cache. Prefixes are looked up first so that would make it unreachable.
+		auto victim = m_entries.begin();
+		for (auto pair = m_entries.begin(); pair != m_entries.end(); ++pair)
+			if (
+				pair->second.lastAccess < victim->second.lastAccess || (
+					pair->second.lastAccess == victim->second.lastAccess &&
+					pair->first.size() > victim->first.size()
+				)
+			)
+				victim = pair;
+
+		m_totalCodeSize -= victim->second.codeSize;
+		m_entries.erase(victim);
+	}
 }
 
 std::map<std::size_t, std::size_t> ProgramCache::countRoundEntries() const
@@ -29,20 +29,6 @@
 namespace solidity::phaser
 {
 
-/**
- * Structure used by @a ProgramCache to store intermediate programs and metadata associated
- * with them.
- */
-struct CacheEntry
-{
-	Program program;
-	size_t roundNumber;
-
-	CacheEntry(Program _program, size_t _roundNumber):
-		program(std::move(_program)),
-		roundNumber(_roundNumber) {}
-};
-
 /**
  * Stores statistics about current cache usage.
  */
@@ -83,6 +69,26 @@ struct CacheStats
 	bool operator!=(CacheStats const& _other) const { return !(*this == _other); }
 };
 
+/**
+ * Structure used by @a ProgramCache to store intermediate programs and metadata associated
+ * with them.
+ */
+struct CacheEntry
+{
+	Program program;
+	size_t roundNumber;
+	/// Size of the program computed using @a CacheStats::StorageWeights.
+	size_t codeSize;
+	/// Value of the cache's access counter at the time the entry was last created or used.
+	size_t lastAccess;
+
+	CacheEntry(Program _program, size_t _roundNumber, size_t _lastAccess = 0):
+		program(std::move(_program)),
+		roundNumber(_roundNumber),
+		codeSize(program.codeSize(CacheStats::StorageWeights)),
+		lastAccess(_lastAccess) {}
+};
+
 /**
  * Class that optimises programs one step at a time which allows it to store and later reuse the
  * results of the intermediate steps.
@@ -99,15 +105,19 @@ struct CacheStats
  * experiments) but there's room for improvement. We could fit more useful programs in
  * the cache by being more picky about which ones we choose.
  *
- * There is currently no way to purge entries without starting a new round. Since the programs
- * take a lot of memory, this may lead to the cache eating up all the available RAM if sequences are
- * long and programs large. A limiter based on entry count or total program size would be useful.
+ * Since the programs take a lot of memory, the total size of the cached programs (as measured
+ * with @a CacheStats::StorageWeights) can be limited with @a _maxTotalCodeSize. When the limit is
+ * exceeded after optimising a program, the least recently used entries are evicted until the
+ * cache fits again. Of entries used equally recently the longest ones go first so that the prefix
+ * of a cached entry is never evicted before the entry itself. The limit may be exceeded
+ * temporarily while a single sequence is being optimised. Zero means no limit.
  */
 class ProgramCache
 {
 public:
-	explicit ProgramCache(Program _program):
-		m_program(std::move(_program)) {}
+	explicit ProgramCache(Program _program, size_t _maxTotalCodeSize = 0):
+		m_program(std::move(_program)),
+		m_maxTotalCodeSize(_maxTotalCodeSize) {}
 
 	Program optimiseProgram(
 		std::string const& _abbreviatedOptimisationSteps,
@@ -125,10 +135,13 @@ public:
 	std::map<std::string, CacheEntry> const& entries() const { return m_entries; }
 	Program const& program() const { return m_program; }
 	size_t currentRound() const { return m_currentRound; }
+	size_t maxTotalCodeSize() const { return m_maxTotalCodeSize; }
 
 private:
-	size_t calculateTotalCachedCodeSize() const;
+	size_t calculateTotalCachedCodeSize() const { return m_totalCodeSize; }
 	std::map<size_t, size_t> countRoundEntries() const;
+	/// Removes the least recently used entries until the total size fits within the limit.
+	void evictEntries();
 
 	// The best matching data structure here would be a trie of chromosome prefixes but since
 	// the programs are orders of magnitude larger than the prefixes, it does not really matter.
@@ -136,6 +149,9 @@ private:
 	std::map<std::string, CacheEntry> m_entries;
 
 	Program m_program;
+	size_t m_maxTotalCodeSize;
+	size_t m_totalCodeSize = 0;
+	size_t m_accessCounter = 0;
 	size_t m_currentRound = 0;
 	size_t m_hits = 0;
 	size_t m_misses = 0;